@@ -0,0 +1,36 @@
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+#include <stdint.h>
+
+// Pre-rendered page backgrounds
+// Each page's static chrome (label box, units, compass or clock face with its
+// letters) is rendered once at build time by tools/gen_backgrounds.c and
+// stored run-length encoded in src/backgrounds.c. Entering a page decodes its
+// image straight into the SPI bursts (or the framebuffer), and erasing a
+// needle or hand restores the background under it from the same image.
+//
+// Each row is encoded on its own so any row can be decoded without the ones
+// above it. A row is a sequence of 16-bit words:
+//   n, color             run of n pixels (1 <= n <= 0x7FFF)
+//   0x8000 | n, c1..cn   n literal pixels
+// and the counts of a row add up to the image width.
+
+#define BG_LITERAL 0x8000u
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    const uint16_t* rows;  // Index in data of each row's first word
+    const uint16_t* data;
+} bg_image_t;
+
+// Generated backgrounds, one per page
+extern const bg_image_t bg_speed;
+extern const bg_image_t bg_location;
+extern const bg_image_t bg_time;
+extern const bg_image_t bg_sky;
+extern const bg_image_t bg_trip;
+extern const bg_image_t bg_all;
+
+#endif
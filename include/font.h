@@ -3,13 +3,41 @@
 
 #include <stdint.h>
 
-// Font dimensions
-#define FONT_WIDTH 8
-#define FONT_HEIGHT 8
-
-// Function to get font data for a character
-// Returns pointer to 8-byte font data array for the given character
-// Returns space character data for unsupported characters
-const unsigned char* get_char_data(char c);
+// Bitmap fonts
+// A font_t is a table of 1-bit glyphs, MSB first (leftmost pixel is bit 7),
+// bytes_per_row bytes per glyph row, drawn at an integer scale. Scaling a row
+// is one lookup per source byte in font_expand2/font_expand3, and the drawn
+// metrics (width, height, advance) are stored so text code never multiplies
+// by the scale itself.
+// The 8x8 font is in src/font.c; src/font_tables.c (the expansion tables and
+// the large digits) is generated by tools/gen_fonts.py from tools/fonts/.
+
+typedef struct {
+    const uint8_t* bitmap;  // Glyphs of characters first..first+count-1
+    uint8_t first;          // First character in the table
+    uint8_t count;          // Characters in the table; the rest draw blank
+    uint8_t rows;           // Source rows per glyph
+    uint8_t bytes_per_row;  // Source bytes per glyph row
+    uint8_t scale;          // 1..3; the scaled row must fit in 32 bits
+    uint8_t width;          // Drawn glyph width in pixels
+    uint8_t height;         // Drawn glyph height in pixels
+    uint8_t advance;        // Distance between glyph origins (width + spacing)
+} font_t;
+
+extern const font_t font_small;   // 8x8, ASCII 32-126
+extern const font_t font_medium;  // 8x8 at 2x (16x16), the default UI text
+extern const font_t font_large;   // 8x8 at 3x (24x24)
+extern const font_t font_digits;  // 12x20 at 2x (24x40), "-./0123456789" for the speed readout
+
+// Each source bit repeated 2 or 3 times (generated)
+extern const uint16_t font_expand2[256];
+extern const uint32_t font_expand3[256];
+
+// First source row of a character's glyph, or NULL if the font lacks it
+const uint8_t* font_glyph(const font_t* font, char c);
+
+// One source row scaled to the font's width, left aligned in 32 bits
+// (bit 31 is the leftmost pixel)
+uint32_t font_expand_row(const font_t* font, const uint8_t* row);
 
 #endif
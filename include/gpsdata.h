@@ -0,0 +1,71 @@
+#ifndef GPSDATA_H
+#define GPSDATA_H
+
+#include <stdint.h>
+
+// Parsed GPS state, filled from NMEA sentences by the parser callbacks in main.c
+// Everything is stored as integers so no consumer has to convert text or floats.
+
+// Bits for gps_data.valid / gps_data.fresh
+#define GPS_HAS_POSITION (1u << 0)  // latitude/longitude
+#define GPS_HAS_SPEED    (1u << 1)  // speed
+#define GPS_HAS_COURSE   (1u << 2)  // course
+#define GPS_HAS_TIME     (1u << 3)  // time
+#define GPS_HAS_DATE     (1u << 4)  // day/month/year
+#define GPS_HAS_FIX      (1u << 5)  // fix/num_sats
+#define GPS_HAS_SATS     (1u << 6)  // sat_count/sats
+#define GPS_HAS_MOTION   (1u << 7)  // motion
+
+// Satellites kept from one GSV cycle (the MTK3339 reports at most 12 per fix,
+// GSV may list a few more in view)
+#define GPS_MAX_SATS 16
+
+typedef struct {
+    uint8_t  prn;           // Satellite PRN, 0 = unused slot
+    uint8_t  elevation;     // Degrees above the horizon (0..90)
+    uint16_t azimuth;       // Degrees clockwise from true north (0..359)
+    uint8_t  snr;           // dB-Hz, 0 = not tracked
+    uint8_t  used;          // Listed by GSA as used in the fix
+} gps_sat_t;
+
+// Motion estimate of the Kalman filter (kalman.h) as of time_ms, in a local
+// north/east frame around an origin; kalman_speed_at and kalman_position_at
+// extrapolate it to any later time
+typedef struct {
+    uint32_t time_ms;       // Time since boot the state refers to
+    int32_t  latitude;      // Origin, micro-degrees
+    int32_t  longitude;
+    int32_t  cos_latitude;  // Q15, east scale at the origin
+    int32_t  position[2];   // North, east from the origin, mm
+    int32_t  velocity[2];   // mm/s
+    int32_t  accel[2];      // mm/s^2
+} gps_motion_t;
+
+typedef struct {
+    int32_t  latitude;      // Micro-degrees, north positive
+    int32_t  longitude;     // Micro-degrees, east positive
+    uint32_t speed;         // km/h x 100
+    uint16_t course;        // Course over ground, centi-degrees (0..35999)
+    int16_t  heading_x;     // Course smoothed as a vector (east, north), Q15;
+    int16_t  heading_y;     // shorter than 1.0 while the course is unsteady
+    uint32_t time;          // UTC seconds of day
+    uint8_t  day;           // UTC date
+    uint8_t  month;
+    uint16_t year;
+    uint8_t  fix;           // GGA fix quality, 0 = no fix
+    uint8_t  num_sats;      // Satellites used in the fix
+    uint16_t hdop;          // Horizontal dilution of precision x 100, 0 = not reported
+    uint8_t  valid;         // GPS_HAS_* bits for fields that hold a value
+    uint8_t  fresh;         // GPS_HAS_* bits updated by the latest sentence
+    uint32_t updated_ms;    // Time since boot of the latest sentence
+    uint8_t  sat_count;     // Entries of sats in use, sorted by PRN
+    gps_sat_t sats[GPS_MAX_SATS];
+    uint32_t trip_distance;  // Trip computer (trip.h): metres since power on or TRIP RESET
+    uint32_t trip_moving;    // Seconds spent moving
+    uint32_t trip_avg_speed; // km/h x 100 over the moving time
+    uint32_t trip_max_speed; // km/h x 100
+    uint32_t odometer;       // Metres, kept in flash
+    gps_motion_t motion;     // Filtered motion as of the latest fix
+} gps_data;
+
+#endif
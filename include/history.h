@@ -0,0 +1,30 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stdint.h>
+
+// Speed history for the graph on the speed page
+// A fixed ring of the last SPEED_HISTORY_LEN speeds, one per UTC second. The
+// GPS parser (core 0) is the only writer; page drawing (core 1) reads it.
+// The writer stores a sample before it bumps count, so a reader that loads
+// count first sees every sample below it. Sample k lives in speed[k % LEN]
+// and stays there until sample k + LEN, so a reader has SPEED_HISTORY_LEN
+// seconds to copy the window it read count for.
+
+#define SPEED_HISTORY_LEN 128
+
+typedef struct {
+    uint16_t speed[SPEED_HISTORY_LEN];  // km/h x 100, capped at 65535
+    volatile uint32_t count;            // Samples ever pushed
+} speed_history_t;
+
+void speed_history_push(speed_history_t* h, uint32_t speed);
+
+// Samples pushed so far; samples max(0, count - LEN) .. count - 1 are readable
+uint32_t speed_history_count(const speed_history_t* h);
+
+static inline uint16_t speed_history_get(const speed_history_t* h, uint32_t k) {
+    return h->speed[k % SPEED_HISTORY_LEN];
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef KALMAN_H
+#define KALMAN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpsdata.h"
+
+// Constant-acceleration Kalman filter for speed and position between fixes
+// North and east are filtered independently, each with state (position mm,
+// velocity mm/s, acceleration mm/s^2) and a 3x3 covariance, all integers.
+// kalman_update runs on every published sentence: GGA positions are measured
+// with a variance from HDOP, and RMC speed and course as a velocity vector.
+// VTG repeats RMC's velocity within the same fix, so the caller passes
+// velocity only for RMC; measuring both would count one reading twice and
+// halve the KALMAN_SPEED_SIGMA variance in effect.
+// The covariance is only propagated there, over the time since the previous
+// fix, so the cost is per fix. In between, the display and the LEDs evaluate
+// the published state at the current time with kalman_speed_at and
+// kalman_position_at, which only read it.
+//
+// Gating: positions without a fix, without HDOP or with HDOP above
+// KALMAN_MAX_HDOP are ignored, and one whose innovation is further than
+// KALMAN_GATE sigma away is rejected. After KALMAN_MAX_REJECTS rejections in
+// a row (the receiver really did jump) or a gap over KALMAN_MAX_GAP_MS
+// the filter restarts from the next position.
+
+#define KALMAN_UERE 4000           // mm, position error per unit of HDOP
+#define KALMAN_MAX_HDOP 500        // x 100
+#define KALMAN_SPEED_SIGMA 250     // mm/s, error of the reported velocity
+#define KALMAN_JERK 2000           // mm/s^3, process noise (change of acceleration)
+#define KALMAN_INIT_SPEED 5000     // mm/s, initial velocity sigma without a speed
+#define KALMAN_INIT_ACCEL 2000     // mm/s^2, initial acceleration sigma
+#define KALMAN_GATE 3              // Sigma
+#define KALMAN_MAX_REJECTS 3
+#define KALMAN_MAX_GAP_MS 5000
+#define KALMAN_MAX_PREDICT_MS 1500 // Extrapolation horizon past the latest fix
+
+typedef struct {
+    int32_t x[3];      // Position mm, velocity mm/s, acceleration mm/s^2
+    int64_t p[3][3];   // Covariance, in the same units
+} kalman_axis_t;
+
+typedef struct {
+    bool active;
+    uint8_t rejects;           // Positions rejected in a row
+    uint32_t time_ms;          // Time of the state
+    int32_t latitude;          // Origin of the local frame: the latest accepted position
+    int32_t longitude;
+    int32_t cos_latitude;      // Q15
+    kalman_axis_t axis[2];     // North, east
+} kalman_t;
+
+void kalman_init(kalman_t* k);
+
+// Feed the staged sentence (its fresh fields, at g->updated_ms); velocity
+// says whether its fresh speed and course are this fix's velocity
+// measurement. True if the estimate changed
+bool kalman_update(kalman_t* k, const gps_data* g, bool velocity);
+
+// Copy the estimate for publishing; false while the filter is not running
+bool kalman_motion(const kalman_t* k, gps_motion_t* out);
+
+// Evaluate a published estimate at now_ms (clamped to KALMAN_MAX_PREDICT_MS
+// past the fix)
+uint32_t kalman_speed_at(const gps_motion_t* m, uint32_t now_ms);  // km/h x 100
+void kalman_position_at(const gps_motion_t* m, uint32_t now_ms, int32_t* latitude, int32_t* longitude);
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef NMEA_H
+#define NMEA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Streaming NMEA 0183 parser
+// Bytes are fed one at a time straight from the UART stream. Every field is
+// reported through on_field as soon as its terminating ',' or '*' arrives
+// (empty fields included, so field indices never shift), and on_sentence
+// reports whether the *hh checksum matched. Consumers should stage fields
+// and only commit them when on_sentence says the sentence is valid.
+
+#define NMEA_FIELD_MAX 15  // Longest field kept (MTK3339 fields are shorter)
+
+// Checksum of a string literal, folded by the compiler in static initializers
+// (XOR of every character; bodies up to 64 characters)
+#define NMEA_CK_AT(s, i) (sizeof(s) > (i) + 1 ? (uint8_t)(s)[i] : 0)
+#define NMEA_CK_4(s, i) (NMEA_CK_AT(s, i) ^ NMEA_CK_AT(s, i + 1) ^ NMEA_CK_AT(s, i + 2) ^ NMEA_CK_AT(s, i + 3))
+#define NMEA_CK_16(s, i) (NMEA_CK_4(s, i) ^ NMEA_CK_4(s, i + 4) ^ NMEA_CK_4(s, i + 8) ^ NMEA_CK_4(s, i + 12))
+#define NMEA_CHECKSUM(s) ((uint8_t)(NMEA_CK_16(s, 0) ^ NMEA_CK_16(s, 16) ^ NMEA_CK_16(s, 32) ^ NMEA_CK_16(s, 48)))
+
+// Sentence types we act on, decoded from field 0 regardless of talker (GP/GN/..)
+typedef enum {
+    NMEA_UNKNOWN = 0,
+    NMEA_RMC,  // Recommended minimum: time, status, position, speed, course, date
+    NMEA_VTG,  // Course and ground speed
+    NMEA_GGA,  // Fix data: time, position, fix quality, satellites
+    NMEA_GSA,  // DOP and active satellites
+    NMEA_GSV,  // Satellites in view
+    NMEA_PMTK  // MTK proprietary ($PMTKxxx)
+} nmea_sentence_t;
+
+// Called for each field; index 0 is the address field (e.g. "GPRMC")
+// text is NUL terminated and only valid during the call
+typedef void (*nmea_field_cb_t)(nmea_sentence_t type, uint8_t index, const char* text, uint8_t len);
+
+// Called at the end of every sentence; valid is false on a checksum mismatch,
+// a missing checksum or an over-long field
+typedef void (*nmea_sentence_cb_t)(nmea_sentence_t type, bool valid);
+
+typedef enum {
+    NMEA_WAIT_START,  // Skipping bytes until '$'
+    NMEA_BODY,        // Inside the sentence, XORing into the checksum
+    NMEA_CHECKSUM_HI, // Expecting first hex digit after '*'
+    NMEA_CHECKSUM_LO  // Expecting second hex digit
+} nmea_state_t;
+
+typedef struct {
+    nmea_state_t state;
+    nmea_sentence_t type;
+    uint8_t checksum;      // Running XOR of the bytes between '$' and '*'
+    uint8_t expected;      // Checksum received after '*'
+    uint8_t field_index;
+    uint8_t field_len;
+    bool overflow;         // A field was longer than NMEA_FIELD_MAX
+    char field[NMEA_FIELD_MAX + 1];
+    nmea_field_cb_t on_field;
+    nmea_sentence_cb_t on_sentence;
+
+    // Statistics
+    uint32_t sentences;        // Sentences with a good checksum
+    uint32_t checksum_errors;  // Sentences rejected
+} nmea_parser_t;
+
+// Reset the parser and register its callbacks
+void nmea_init(nmea_parser_t* p, nmea_field_cb_t on_field, nmea_sentence_cb_t on_sentence);
+
+// Feed one received byte
+void nmea_feed(nmea_parser_t* p, char c);
+
+// Field decoders; each returns false for an empty or malformed field
+
+// Decimal number scaled by 10^decimals ("12.345", 2 -> 1234), extra digits truncated
+bool nmea_parse_fixed(const char* text, uint8_t decimals, int32_t* out);
+
+// ddmm.mmmm / dddmm.mmmm coordinate in micro-degrees (hemisphere not applied)
+bool nmea_parse_coord(const char* text, int32_t* out);
+
+// hhmmss(.sss) UTC time as seconds of day
+bool nmea_parse_time(const char* text, uint32_t* out);
+
+// ddmmyy date
+bool nmea_parse_date(const char* text, uint8_t* day, uint8_t* month, uint16_t* year);
+
+#endif
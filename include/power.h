@@ -0,0 +1,49 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Power manager
+// power_tick runs once a second with what the latest fix says. After
+// POWER_IDLE_S without movement the display drops to idle mode (8 colours,
+// slow redraw); after park_s the display sleeps and the GPS goes to standby.
+// In standby the GPS is woken every POWER_CHECK_S to look for movement: a
+// moving fix wakes everything, POWER_CHECK_FIXES still ones (or
+// POWER_CHECK_MAX_S without a fix) send it back to standby. A button press
+// wakes everything and restarts the count. Only the decisions live here;
+// the caller drives the panel and the module.
+
+#define POWER_IDLE_S 30
+#define POWER_PARK_S 300        // Default park_s
+#define POWER_CHECK_S 60
+#define POWER_CHECK_FIXES 5
+#define POWER_CHECK_MAX_S 30
+
+typedef enum {
+    POWER_AWAKE,     // Normal running
+    POWER_IDLE,      // Parked a while: display in idle mode
+    POWER_STANDBY,   // Parked: display asleep, GPS in standby
+    POWER_CHECK      // Display asleep, GPS woken to look for movement
+} power_state_t;
+
+typedef struct {
+    power_state_t state;
+    uint32_t park_s;       // Seconds without movement before standby, 0 = never
+    uint32_t parked_s;     // Seconds without movement so far
+    uint32_t state_s;      // Seconds in the current state
+    uint8_t check_fixes;   // Still fixes seen by the current check
+} power_t;
+
+void power_init(power_t* p, uint32_t park_s);
+
+// One second passed; moving = the latest fix shows movement, fix = a new fix
+// arrived during that second. Returns the new state.
+power_state_t power_tick(power_t* p, bool moving, bool fix);
+
+// Button press: back to POWER_AWAKE and start counting again
+void power_wake(power_t* p);
+
+const char* power_state_name(power_state_t state);
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Cycle profiling of interrupt handlers and draw functions
+// PROFILE_BEGIN/PROFILE_END bracket a block and record its length in CPU
+// cycles, read from the Cortex-M33 DWT cycle counter of the core running it.
+// Each profiled block has a profile_t with count, min, max, total and a log2
+// histogram; recording is a handful of instructions (one CLZ for the bucket)
+// and takes no lock, so it can stay on in normal builds.
+// With PROFILE_ENABLED 0 the macros expand to nothing and no table is needed.
+// A profile_t is only written by the core whose handler it measures; a dump
+// from the other core may see one update half done.
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 1
+#endif
+
+#define PROFILE_BUCKETS 32  // Bucket b counts lengths in [2^b, 2^(b+1)) cycles
+
+typedef struct {
+    const char* name;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t hist[PROFILE_BUCKETS];
+} profile_t;
+
+#if PROFILE_ENABLED
+
+#include "hardware/structs/m33.h"
+
+// Start the cycle counter of the calling core; call once on each core
+void profile_init(void);
+
+void profile_record(profile_t* p, uint32_t cycles);
+void profile_reset(profile_t* table, size_t count);
+void profile_dump(const profile_t* table, size_t count);
+
+static inline uint32_t profile_cycles(void) {
+    return m33_hw->dwt_cyccnt;
+}
+
+// start names a local holding the start count; wrap-around is harmless
+#define PROFILE_BEGIN(start) uint32_t start = profile_cycles()
+#define PROFILE_END(table, id, start) profile_record(&(table)[id], profile_cycles() - (start))
+
+#else
+
+static inline void profile_init(void) {}
+#define PROFILE_BEGIN(start) ((void)0)
+#define PROFILE_END(table, id, start) ((void)0)
+
+#endif
+
+#endif
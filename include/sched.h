@@ -0,0 +1,96 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Cooperative scheduler, one per core
+// Work runs from the core's main loop instead of inside interrupt handlers:
+// an ISR only posts an event (sched_post) or queues a work item
+// (sched_defer), and sched_run_once runs the highest priority work that is
+// ready. Tasks run to completion, so interrupts are only held off for the few
+// instructions of a post, never for a redraw or a flash write.
+//
+// A task's priority is its index in the table passed to sched_init, 0 first;
+// the run queue is a bit mask, so picking the next task is one CTZ. A task
+// with a period is also made ready by a timer. Each scheduler owns one TIMER0
+// alarm, set to the earliest timer, and the alarm interrupt only flags that
+// the timers need a look. Deferred work items are one-shot calls with an
+// argument, run in order once no task is ready.
+//
+// Every run is timed: its latency from becoming ready and its length against
+// the task's budget, its deadline; sched_dump prints the totals.
+// sched_post and sched_defer may be called from this core's interrupts and
+// tasks, not from the other core.
+
+#define SCHED_MAX_TASKS 32
+#define SCHED_WORK_SIZE 16  // Power of two
+
+typedef void (*sched_fn_t)(void* arg);
+
+typedef struct {
+    uint32_t runs;
+    uint32_t overruns;         // Runs longer than the budget
+    uint32_t max_run_us;
+    uint32_t max_latency_us;   // From ready to started
+    uint64_t total_us;
+} sched_stats_t;
+
+typedef struct {
+    const char* name;
+    void (*run)(void);
+    uint32_t period_us;        // Also run this often, 0 = only when posted
+    uint32_t budget_us;        // Deadline for one run
+
+    // Kept by the scheduler
+    bool timer_on;
+    uint32_t due_us;           // Next timer expiry
+    uint32_t ready_us;         // When the task was posted or fell due
+    sched_stats_t stats;
+} sched_task_t;
+
+typedef struct {
+    sched_fn_t fn;
+    void* arg;
+    uint32_t queued_us;
+} sched_work_t;
+
+typedef struct {
+    sched_task_t* tasks;
+    uint8_t count;
+    uint8_t alarm;                   // TIMER0 alarm behind the task timers
+    volatile uint32_t ready;         // Run queue, bit n = task n
+    volatile bool timer_event;       // A timer may have expired
+    sched_work_t work[SCHED_WORK_SIZE];
+    volatile uint32_t work_head;     // Next free slot
+    uint32_t work_tail;              // Next item to run
+    uint32_t work_budget_us;
+    uint32_t work_dropped;           // sched_defer calls that found the queue full
+    sched_stats_t work_stats;
+} sched_t;
+
+// Take over tasks (priority order) and TIMER0 alarm; call on the core that
+// will run them. Periodic tasks first run one period from now.
+void sched_init(sched_t* s, sched_task_t* tasks, uint8_t count, uint8_t alarm, uint32_t work_budget_us);
+
+// Make task id ready
+void sched_post(sched_t* s, uint8_t id);
+
+// Queue fn(arg) to run after the ready tasks; false if the queue is full
+bool sched_defer(sched_t* s, sched_fn_t fn, void* arg);
+
+// (Re)start task id's timer so it next runs delay_us from now
+void sched_timer(sched_t* s, uint8_t id, uint32_t delay_us);
+
+// Run the highest priority ready task, else one work item; false if idle,
+// so the caller may wait for an interrupt
+bool sched_run_once(sched_t* s);
+
+// Sleep in WFI until an interrupt, unless work arrived since sched_run_once
+// said there was none
+void sched_idle(sched_t* s);
+
+// Print each task's runs, times and overruns
+void sched_dump(const sched_t* s, const char* name);
+
+#endif
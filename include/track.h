@@ -0,0 +1,92 @@
+#ifndef TRACK_H
+#define TRACK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Append-only track log in NOR flash
+// The region is a ring of 4 KB sectors used strictly in order, so every sector
+// is erased equally often. Each sector starts with a header carrying its
+// sequence number; records are batched in a RAM page buffer and programmed a
+// 256 byte page at a time. After a power loss the log is found again by
+// scanning the sector headers, and the record area of the newest sector.
+// Flash access goes through track_flash_t so the log does not depend on the SDK.
+
+#define TRACK_PAGE_SIZE 256
+#define TRACK_SECTOR_SIZE 4096
+#define TRACK_MAGIC 0x4B525431u  // "1TRK"
+
+// One fix, 16 bytes so records never straddle a page
+typedef struct {
+    uint32_t time;       // Seconds since 2000-01-01 UTC, 0xFFFFFFFF = erased
+    int32_t latitude;    // Micro-degrees
+    int32_t longitude;   // Micro-degrees
+    uint16_t speed;      // km/h x 100
+    uint8_t course;      // 360/256 degree steps
+    uint8_t check;       // XOR of the other 15 bytes, catches torn pages
+} track_record_t;
+
+// First 16 bytes of every written sector
+typedef struct {
+    uint32_t magic;      // TRACK_MAGIC
+    uint32_t sequence;   // Sectors written before this one; sector = sequence % sector count
+    uint32_t reserved[2];
+} track_sector_t;
+
+#define TRACK_PAGE_RECORDS (TRACK_PAGE_SIZE / sizeof(track_record_t))
+#define TRACK_SECTOR_RECORDS (TRACK_SECTOR_SIZE / sizeof(track_record_t) - 1)  // Header takes one slot
+
+// Flash backend; offsets are relative to the start of the log region
+// erase and program are only called with sector / page aligned offsets
+typedef struct {
+    uint32_t size;                                              // Multiple of TRACK_SECTOR_SIZE
+    void (*read)(uint32_t offset, void* out, uint32_t len);
+    void (*erase)(uint32_t offset);                             // One sector
+    void (*program)(uint32_t offset, const uint8_t* data);      // One page
+} track_flash_t;
+
+typedef struct {
+    const track_flash_t* flash;
+    uint32_t sectors;        // Sectors in the region
+    uint32_t oldest;         // Sequence of the oldest sector still in the log
+    uint32_t head;           // Sequence of the sector being written
+    bool open;               // head has been erased and has its header
+    uint16_t page;           // Page of head that the buffer will be programmed to
+    uint16_t page_fill;      // Bytes used in the page buffer
+    uint8_t page_buf[TRACK_PAGE_SIZE];
+    uint32_t appended;       // Records accepted since track_init
+    uint32_t erases;         // Sector erases since track_init
+    uint32_t programs;       // Page programs since track_init
+} track_log_t;
+
+// Find the log in flash; an empty or foreign region starts a new log
+void track_init(track_log_t* log, const track_flash_t* flash);
+
+// Add a record to the page buffer, programming the page once it is full
+void track_append(track_log_t* log, const track_record_t* rec);
+
+// Program a partly filled page buffer now (the rest of that page stays unused)
+void track_sync(track_log_t* log);
+
+// Record index of the oldest entry; indices count every slot ever written,
+// so an index stays valid until the log wraps past it
+uint32_t track_first(const track_log_t* log);
+
+// Read the first valid record at or after *index (flash and page buffer)
+// On success *index is that record's index; false once the log is exhausted
+bool track_read(const track_log_t* log, uint32_t* index, track_record_t* rec);
+
+// Find the next run of record slots that are already programmed, for readers
+// that stream straight from memory-mapped flash. From *index (moved forward
+// past sectors that left the log), returns how many consecutive slots follow
+// in one sector and their region offset in *offset; 0 once nothing more is in
+// flash. Slots may be erased or torn, so readers still check each record.
+uint32_t track_extent(const track_log_t* log, uint32_t* index, uint32_t* offset);
+
+// Fill in rec->check and return rec
+track_record_t* track_seal(track_record_t* rec);
+
+// Seconds since 2000-01-01 for a UTC date and seconds of day
+uint32_t track_time(uint16_t year, uint8_t month, uint8_t day, uint32_t seconds);
+
+#endif
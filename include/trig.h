@@ -0,0 +1,41 @@
+#ifndef TRIG_H
+#define TRIG_H
+
+#include <stdint.h>
+
+// Fixed-point trigonometry for the render paths
+// Angles are binary: a uint16_t where 65536 is one full turn, so wrapping is
+// free and any angle is a valid table index. Results are Q15 (32767 = 1.0).
+// The quarter-wave table in src/sine_table.c is generated by
+// tools/gen_sine_table.py; between entries sin_q15 interpolates linearly.
+// Screen convention: angle 0 points up (north), angles grow clockwise, so a
+// point at distance r is (cx + r * sin, cy - r * cos).
+
+#define ANGLE_QUARTER 16384u
+#define SINE_TABLE_BITS 8  // Entries per quarter turn, as a power of two
+
+// sin of 0..90 degrees in 2^SINE_TABLE_BITS steps, plus the 90 degree entry
+extern const int16_t sine_table[(1 << SINE_TABLE_BITS) + 1];
+
+// Whole degrees and centi-degrees to binary angle
+#define ANGLE_FROM_DEGREES(d) ((uint16_t)((uint32_t)(d) * 65536u / 360u))
+#define ANGLE_FROM_CENTIDEGREES(cd) ((uint16_t)((uint32_t)(cd) * 65536u / 36000u))
+
+// Micro-degrees of latitude (or of longitude times cos(latitude)) to
+// millimetres along a great circle (mean Earth radius 6371008.8 m): 111.195
+#define MM_PER_UDEG_NUM 111195
+#define MM_PER_UDEG_DEN 1000
+
+int32_t sin_q15(uint16_t angle);
+int32_t cos_q15(uint16_t angle);
+
+// Multiply by a Q15 value, rounded to the nearest integer
+int32_t mul_q15(int32_t value, int32_t q15);
+
+// Integer square root, rounded down
+uint32_t isqrt32(uint32_t value);
+
+// sqrt(a^2 + b^2) with isqrt32; large values lose their low bits
+uint64_t hypot64(int64_t a, int64_t b);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef TRIP_H
+#define TRIP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpsdata.h"
+#include "track.h"
+
+// Trip computer
+// trip_update takes every published fix and keeps distance, moving time and
+// max speed up to date in O(1). The step from the previous position is
+// measured on a flat plane around a reference latitude (equirectangular):
+// north is 1:1 in micro-degrees, east is scaled by cos(latitude) in Q15 from
+// the sine table, which is only looked up again once the latitude has moved
+// TRIP_REF_DRIFT away from the reference. Fixes slower than TRIP_MOVING_SPEED
+// only move the reference point, so standing still adds no position noise.
+//
+// The odometer survives power loss in its own two-sector flash store, using
+// the same backend interface as the track log. Each entry is a total in
+// metres with its complement; one is appended every ODOMETER_SAVE_METERS, the
+// largest valid entry wins on start, and when a sector fills the other one
+// is erased and takes over.
+
+#define TRIP_MOVING_SPEED 200   // km/h x 100
+#define TRIP_REF_DRIFT 50000    // Micro-degrees (~5.5 km) before cos(latitude) is looked up again
+#define TRIP_MAX_GAP 10         // Seconds; a longer gap between fixes is not counted
+#define ODOMETER_SAVE_METERS 100
+#define ODOMETER_SECTORS 2
+
+typedef struct {
+    uint32_t meters;
+    uint32_t check;  // ~meters, so erased and torn entries fail
+} odometer_entry_t;
+
+#define ODOMETER_SECTOR_ENTRIES (TRACK_SECTOR_SIZE / sizeof(odometer_entry_t))
+
+typedef struct {
+    // Since power on or trip_reset
+    uint64_t distance_mm;
+    uint32_t moving_s;
+    uint32_t max_speed;        // km/h x 100
+
+    // Previous fix and the projection reference
+    bool have_fix;
+    int32_t latitude;
+    int32_t longitude;
+    uint32_t time;             // UTC seconds of day
+    int32_t ref_latitude;
+    int32_t cos_latitude;      // Q15
+
+    // Odometer
+    uint64_t odometer_mm;
+    uint32_t saved_m;          // Last total written to flash
+    const track_flash_t* flash;  // ODOMETER_SECTORS sectors, NULL to keep it in RAM only
+    uint32_t slot;             // Next entry, counted across the sectors
+} trip_t;
+
+// Start a trip and load the odometer from flash (if any)
+void trip_init(trip_t* t, const track_flash_t* flash);
+
+// Zero the trip figures; the odometer keeps counting
+void trip_reset(trip_t* t);
+
+// Account for a published fix; only fixes with a fresh position count
+void trip_update(trip_t* t, const gps_data* g);
+
+// The odometer has gone ODOMETER_SAVE_METERS past the stored total
+// trip_update never writes flash itself, so the caller can do it at a
+// better time: trip_save appends the total if it is still due
+bool trip_save_due(const trip_t* t);
+void trip_save(trip_t* t);
+
+// Trip figures
+uint32_t trip_distance_m(const trip_t* t);
+uint32_t trip_avg_speed(const trip_t* t);  // km/h x 100 over moving time
+uint32_t trip_odometer_m(const trip_t* t);
+
+#endif
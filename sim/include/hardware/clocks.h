@@ -0,0 +1,10 @@
+#ifndef SIM_HARDWARE_CLOCKS_H
+#define SIM_HARDWARE_CLOCKS_H
+
+#include "pico.h"
+
+enum clock_num { clk_gpout0, clk_gpout1, clk_gpout2, clk_gpout3, clk_ref, clk_sys, clk_peri, clk_hstx, clk_usb, clk_adc };
+
+uint32_t clock_get_hz(enum clock_num clk_index);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef SIM_HARDWARE_IRQ_H
+#define SIM_HARDWARE_IRQ_H
+
+#include "pico.h"
+
+// RP2350 interrupt numbers for the peripherals the firmware uses
+enum {
+    TIMER0_IRQ_0 = 0,
+    TIMER0_IRQ_1 = 1,
+    TIMER0_IRQ_2 = 2,
+    TIMER0_IRQ_3 = 3,
+    PWM_IRQ_WRAP_0 = 8,
+    PWM_IRQ_WRAP_1 = 9,
+    DMA_IRQ_0 = 10,
+    DMA_IRQ_1 = 11,
+    IO_IRQ_BANK0 = 21,
+    UART0_IRQ = 33,
+    UART1_IRQ = 34,
+    SIM_IRQ_COUNT = 52
+};
+
+#define PWM_DEFAULT_IRQ_NUM() PWM_IRQ_WRAP_0
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_set_enabled(uint num, bool enabled);
+void irq_set_priority(uint num, uint8_t priority);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef SIM_HARDWARE_PWM_H
+#define SIM_HARDWARE_PWM_H
+
+#include "pico.h"
+#include "hardware/gpio.h"
+
+#define NUM_PWM_SLICES 12
+
+typedef struct {
+    volatile uint32_t csr;
+    volatile uint32_t div;   // 8.4 fixed point
+    volatile uint32_t ctr;
+    volatile uint32_t cc;
+    volatile uint32_t top;
+} pwm_slice_hw_t;
+
+// intr is acknowledged by writing it from the wrap handler (see timer.h)
+typedef struct {
+    pwm_slice_hw_t slice[NUM_PWM_SLICES];
+    volatile uint32_t en;
+    volatile uint32_t intr;
+    volatile uint32_t irq0_inte;
+    volatile uint32_t irq1_inte;
+} pwm_hw_t;
+
+extern pwm_hw_t* const pwm_hw;
+
+static inline uint pwm_gpio_to_slice_num(uint gpio) { return (gpio >> 1u) % NUM_PWM_SLICES; }
+static inline uint pwm_gpio_to_channel(uint gpio) { return gpio & 1u; }
+
+void pwm_set_clkdiv(uint slice_num, float divider);
+void pwm_set_wrap(uint slice_num, uint16_t wrap);
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level);
+void pwm_set_both_levels(uint slice_num, uint16_t level_a, uint16_t level_b);
+void pwm_set_enabled(uint slice_num, bool enabled);
+void pwm_set_irq0_enabled(uint slice_num, bool enabled);
+void pwm_set_irq1_enabled(uint slice_num, bool enabled);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef SIM_HARDWARE_STRUCTS_M33_H
+#define SIM_HARDWARE_STRUCTS_M33_H
+
+#include "pico.h"
+
+// The parts of the Cortex-M33 private peripherals the firmware touches.
+// The simulator keeps dwt_cyccnt in step with the virtual clock at clk_sys
+// once CYCCNTENA is set; both cores share one counter. Only modeled time
+// (bus transfers, waits) shows up in it, plain computation costs nothing here.
+typedef struct {
+    volatile uint32_t dwt_ctrl;
+    volatile uint32_t dwt_cyccnt;
+    volatile uint32_t demcr;
+} m33_hw_t;
+
+#define M33_DWT_CTRL_CYCCNTENA_BITS 0x00000001u
+#define M33_DEMCR_TRCENA_BITS 0x01000000u
+
+extern m33_hw_t* const m33_hw;
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef SIM_HARDWARE_SYNC_H
+#define SIM_HARDWARE_SYNC_H
+
+#include "pico.h"
+
+// Interrupt masking is per simulated core
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+// Sleep until an interrupt: the simulator jumps the clock to the next event
+void __wfi(void);
+void __wfe(void);
+void __sev(void);
+
+#define __dmb() __sync_synchronize()
+#define __mem_fence_acquire() __sync_synchronize()
+#define __mem_fence_release() __sync_synchronize()
+
+uint get_core_num(void);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef SIM_HARDWARE_TIMER_H
+#define SIM_HARDWARE_TIMER_H
+
+#include "pico.h"
+
+// TIMER0 registers; the simulator keeps timerawl in step with the virtual
+// clock, arms an alarm when its value is written and treats a write to intr
+// from the handler as the acknowledge
+typedef struct {
+    volatile uint32_t timehw;
+    volatile uint32_t timelw;
+    volatile uint32_t timehr;
+    volatile uint32_t timelr;
+    volatile uint32_t alarm[4];
+    volatile uint32_t armed;
+    volatile uint32_t timerawh;
+    volatile uint32_t timerawl;
+    volatile uint32_t dbgpause;
+    volatile uint32_t pause;
+    volatile uint32_t locked;
+    volatile uint32_t source;
+    volatile uint32_t intr;
+    volatile uint32_t inte;
+    volatile uint32_t intf;
+    volatile uint32_t ints;
+} timer_hw_t;
+
+extern timer_hw_t* const timer0_hw;
+#define timer_hw timer0_hw
+
+#endif
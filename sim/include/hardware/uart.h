@@ -0,0 +1,35 @@
+#ifndef SIM_HARDWARE_UART_H
+#define SIM_HARDWARE_UART_H
+
+#include "pico.h"
+#include "hardware/gpio.h"
+
+// uart1 is wired to the simulated MTK3339 (sim/sim_uart.c)
+typedef struct uart_inst uart_inst_t;
+extern uart_inst_t* const uart0;
+extern uart_inst_t* const uart1;
+
+typedef struct {
+    volatile uint32_t dr;  // DMA paced by the RX DREQ is fed by the simulator instead
+    volatile uint32_t rsr;
+} uart_hw_t;
+
+typedef enum { UART_PARITY_NONE, UART_PARITY_EVEN, UART_PARITY_ODD } uart_parity_t;
+
+#define UART_FUNCSEL_NUM(uart, gpio) GPIO_FUNC_UART
+
+uint uart_init(uart_inst_t* uart, uint baudrate);
+uint uart_set_baudrate(uart_inst_t* uart, uint baudrate);
+void uart_set_format(uart_inst_t* uart, uint data_bits, uint stop_bits, uart_parity_t parity);
+void uart_set_fifo_enabled(uart_inst_t* uart, bool enabled);
+void uart_set_irq_enables(uart_inst_t* uart, bool rx_has_data, bool tx_needs_data);
+bool uart_is_readable(uart_inst_t* uart);
+bool uart_is_writable(uart_inst_t* uart);
+char uart_getc(uart_inst_t* uart);
+void uart_putc_raw(uart_inst_t* uart, char c);
+void uart_write_blocking(uart_inst_t* uart, const uint8_t* src, size_t len);
+void uart_tx_wait_blocking(uart_inst_t* uart);
+uart_hw_t* uart_get_hw(uart_inst_t* uart);
+uint uart_get_dreq_num(uart_inst_t* uart, bool is_tx);
+
+#endif
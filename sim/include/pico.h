@@ -0,0 +1,24 @@
+#ifndef SIM_PICO_H
+#define SIM_PICO_H
+
+// Host stand-in for the Pico SDK base header (see sim/sim.h)
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+#define PICO_OK 0
+#define PICO_ERROR_TIMEOUT (-1)
+#define PICO_ERROR_GENERIC (-2)
+#define PICO_ERROR_NOT_PERMITTED (-4)
+
+#define __not_in_flash_func(name) name
+#define __no_inline_not_in_flash_func(name) name
+#define __time_critical_func(name) name
+
+// Busy-wait hint; in the simulator this is where a core yields
+void tight_loop_contents(void);
+
+#endif
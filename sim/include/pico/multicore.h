@@ -0,0 +1,9 @@
+#ifndef SIM_PICO_MULTICORE_H
+#define SIM_PICO_MULTICORE_H
+
+#include "pico.h"
+
+// Core 1 runs as a coroutine that is switched to whenever core 0 idles
+void multicore_launch_core1(void (*entry)(void));
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef SIM_PICO_RAND_H
+#define SIM_PICO_RAND_H
+
+#include "pico.h"
+
+uint32_t get_rand_32(void);
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef SIM_PICO_STDIO_USB_H
+#define SIM_PICO_STDIO_USB_H
+
+#include "pico.h"
+
+typedef struct stdio_driver stdio_driver_t;
+extern stdio_driver_t stdio_usb;
+
+void stdio_set_driver_enabled(stdio_driver_t* driver, bool enabled);
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdio.h>
+#include "pico.h"
+
+// Host simulation of the board ([env:native] in platformio.ini)
+// src/main.c is built unchanged against the stand-in SDK headers next to this
+// file. Everything runs on one host thread against a virtual clock:
+//  - time only moves when the firmware waits (sleep, __wfi, tight_loop_contents,
+//    reading the clock) or when a peripheral is busy (SPI and UART bytes take
+//    their modeled wire time, flash erase/program take their datasheet time)
+//  - core 1 is a coroutine; a core that waits hands over to the other one, and
+//    when both wait the clock jumps straight to the next event
+//  - interrupts are raised from peripheral state and run on the core that
+//    enabled them, unless that core is masked or already in a handler
+// The SPI bus decodes ILI9341 commands into a framebuffer, and uart1 talks to
+// a simulated MTK3339 that replays an NMEA capture and answers PMTK commands.
+
+// Pins the simulator needs to recognise; must match the constants in main.c
+#define SIM_SPI_CSN 17
+#define SIM_DISP_DC 20
+#define SIM_BUTTON_NEXT 21  // button_1
+
+#define SIM_CLK_SYS_HZ 150000000u
+#define SIM_CLK_PERI_HZ 150000000u
+
+typedef struct {
+    const char* nmea_path;   // Capture replayed by the simulated GPS
+    bool nmea_loop;          // Start the capture over when it ends
+    uint32_t gps_baud;       // Rate the simulated GPS starts at
+    double seconds;          // Simulated run time, 0 = until the capture ends
+    uint32_t press_ms;       // Press the next-page button this often, 0 = never
+    uint32_t bounce;         // Extra contact bounce edges after each press
+    const char* ppm_dir;     // Write the panel after every page draw, per page
+    const char* flash_path;  // File backing the 16 MB flash, kept across runs
+    bool dirty_flash;        // Start with flash programmed to 0x00 instead of erased
+    bool quiet;              // Drop the firmware's own printf output
+} sim_options_t;
+
+extern sim_options_t sim_opt;
+extern uint64_t sim_now_ns;
+extern uint64_t sim_press_ns;  // Latest button press (not counting bounce), 0 if none
+extern FILE* sim_log;  // Where the simulator reports (stderr)
+
+// Clock
+void sim_advance(uint64_t ns);           // Let time pass, delivering events and interrupts
+void sim_wait_until(uint64_t deadline);  // Current core waits; the other core may run
+void sim_poll_point(void);               // Busy-polling code: charge a little time, maybe switch cores
+void sim_finish(void);                   // Print the reports and exit
+
+// Interrupts
+uint sim_current_core(void);
+void sim_dispatch(void);                 // Run every asserted interrupt that is allowed to
+
+// Peripheral event sources (next time in ns, UINT64_MAX if none) and interrupt lines
+uint64_t sim_timer_next(void);
+void sim_timer_fire(void);
+bool sim_timer_line(uint num);
+void sim_timer_ack(uint num);
+uint64_t sim_pwm_next(void);
+void sim_pwm_fire(void);
+bool sim_pwm_line(uint num);
+void sim_pwm_ack(void);
+bool sim_gpio_line(void);
+void sim_gpio_dispatch(void);
+uint64_t sim_dma_next(void);
+void sim_dma_fire(void);
+bool sim_dma_line(uint num);
+bool sim_dma_rx(uint dreq, uint8_t b);   // A byte for a DREQ-paced channel; false if none takes it
+uint64_t sim_uart_next(void);
+void sim_uart_fire(void);
+bool sim_uart_line(void);
+bool sim_uart_done(void);                // Capture fully delivered
+uint32_t sim_uart_overruns(void);        // Bytes lost to a full uart1 RX FIFO so far
+
+// Pin levels seen by the SPI decoder
+bool sim_gpio_level(uint gpio);
+
+// SPI bus: bytes with the current DC level, timed at the current rate
+void sim_spi_bytes(const uint8_t* data, size_t len);
+
+// Startup: flash image and NMEA capture named in sim_opt
+void sim_flash_load(void);
+void sim_uart_load(void);
+
+// Reports
+void sim_cpu_report(void);
+void sim_spi_report(void);
+void sim_uart_report(void);
+void sim_flash_report(void);
+void sim_flash_save(void);
+
+// NMEA parser benchmark on a capture, run instead of the firmware
+int sim_replay(const char* path);
+
+// Called by the firmware's spi_stats_report after each page draw
+void sim_frame_report(const char* label, uint32_t transactions, uint32_t bytes, uint32_t windows);
+
+// Called by disp_page after each flushed framebuffer draw: compares it with
+// the decoded panel memory, and under --ppm returns DIR/<page>.fb.ppm opened
+// for tft_fb_dump_ppm (NULL otherwise; the caller closes it)
+FILE* sim_framebuffer_report(const char* label, const uint16_t* framebuffer);
+
+// Called by the track log's flash backend with each page it programs
+void sim_track_program(uint32_t offset, const uint8_t* page);
+
+// Called by gps_poll with bytes the DMA overwrote before they were read
+void sim_gps_dropped(uint32_t bytes);
+
+// Called by disp_page with the latest fix's speed and the filtered speed it drew
+void sim_motion_report(uint32_t raw_speed, uint32_t shown_speed);
+
+#endif
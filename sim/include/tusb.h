@@ -0,0 +1,14 @@
+#ifndef SIM_TUSB_H
+#define SIM_TUSB_H
+
+#include "pico.h"
+
+// No USB host is attached in the simulator
+bool tud_cdc_connected(void);
+uint32_t tud_cdc_available(void);
+int32_t tud_cdc_read_char(void);
+uint32_t tud_cdc_write_available(void);
+uint32_t tud_cdc_write(const void* buffer, uint32_t size);
+uint32_t tud_cdc_write_flush(void);
+
+#endif
@@ -0,0 +1,716 @@
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "pico/rand.h"
+#include "pico/flash.h"
+#include "pico/stdio_usb.h"
+#include "tusb.h"
+#include "hardware/sync.h"
+#include "hardware/irq.h"
+#include "hardware/timer.h"
+#include "hardware/pwm.h"
+#include "hardware/flash.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/m33.h"
+
+// Clock, cores, interrupts and the small peripherals (timer, GPIO, PWM, flash)
+
+uint64_t sim_now_ns = 0;
+FILE* sim_log = NULL;
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Cores
+// Each core's main flow is a context. A core that waits marks itself idle and
+// switches to the other one if it still has work; when both are idle the clock
+// jumps to the earliest event or wake-up deadline.
+#define SIM_CORE1_STACK (1024 * 1024)
+
+static ucontext_t core_ctx[2];
+static bool core1_launched = false;
+static uint core_running = 0;          // Core whose main flow owns the host thread
+static uint core_current = 0;          // Core executing right now (handler or main)
+static bool core_idle[2];
+static uint64_t core_wake[2];          // Deadline of an idle core
+static uint32_t core_idle_events[2];   // Event count when the core went idle
+static uint32_t event_count = 0;
+static bool core_masked[2];            // save_and_disable_interrupts in effect
+static bool core_in_handler[2];
+static bool core_wfi[2];               // In __wfi: a pending interrupt wakes it even when masked
+static bool core_asleep[2];            // In __wfi, __wfe or sleep_us
+static uint64_t core_asleep_ns[2];
+
+uint sim_current_core(void) {
+    return core_current;
+}
+
+uint get_core_num(void) {
+    return core_current;
+}
+
+static void switch_to(uint core) {
+    uint me = core_running;
+    core_running = core;
+    core_current = core;
+    swapcontext(&core_ctx[me], &core_ctx[core]);
+    core_running = me;
+    core_current = me;
+}
+
+static void (*core1_entry)(void);
+
+static void core1_trampoline(void) {
+    core1_entry();
+    // Returning from core 1's entry leaves it idle for good
+    for (;;) sim_wait_until(UINT64_MAX);
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+    core1_entry = entry;
+    getcontext(&core_ctx[1]);
+    core_ctx[1].uc_stack.ss_sp = malloc(SIM_CORE1_STACK);
+    core_ctx[1].uc_stack.ss_size = SIM_CORE1_STACK;
+    core_ctx[1].uc_link = NULL;
+    makecontext(&core_ctx[1], core1_trampoline, 0);
+    core1_launched = true;
+    switch_to(1);  // Core 1 runs until it first waits
+}
+
+void sim_cpu_report(void) {
+    fprintf(sim_log, "\nCPU busy (outside WFI, WFE and sleeps): core 0 %.1f%%, core 1 %.1f%%\n",
+            100.0 - 100.0 * core_asleep_ns[0] / sim_now_ns, 100.0 - 100.0 * core_asleep_ns[1] / sim_now_ns);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Clock
+
+static uint64_t capture_done_ns = 0;  // When the simulated GPS ran out of capture
+static uint64_t press_next_ns = 0;
+static uint64_t bounce_next_ns = UINT64_MAX;
+static uint32_t bounce_left = 0;
+uint64_t sim_press_ns = 0;
+
+#define SIM_BOUNCE_NS 300000
+
+// Explicit run time, else two seconds after the capture ends, else 30 s
+static uint64_t sim_end_ns(void) {
+    if (sim_opt.seconds > 0) return (uint64_t)(sim_opt.seconds * 1e9);
+    if (!sim_opt.nmea_path || sim_opt.nmea_loop) return 30000000000ull;
+    return capture_done_ns ? capture_done_ns + 2000000000ull : UINT64_MAX;
+}
+
+static uint64_t next_event(void) {
+    uint64_t next = sim_end_ns();
+    uint64_t t;
+    if ((t = sim_timer_next()) < next) next = t;
+    if ((t = sim_pwm_next()) < next) next = t;
+    if ((t = sim_dma_next()) < next) next = t;
+    if ((t = sim_uart_next()) < next) next = t;
+    if (sim_opt.press_ms) {
+        if (!press_next_ns) press_next_ns = sim_opt.press_ms * 1000000ull;
+        if (press_next_ns < next) next = press_next_ns;
+    }
+    if (bounce_next_ns < next) next = bounce_next_ns;
+    return next;
+}
+
+static uint64_t cyccnt_ns = 0;  // Time dwt_cyccnt was last brought up to date
+
+static void set_time(uint64_t t) {
+    if (t <= sim_now_ns) return;
+    for (uint core = 0; core < 2; core++) {
+        if (core_asleep[core]) core_asleep_ns[core] += t - sim_now_ns;
+    }
+    sim_now_ns = t;
+    uint64_t us = t / 1000;
+    timer0_hw->timerawl = (uint32_t)us;
+    timer0_hw->timerawh = (uint32_t)(us >> 32);
+    timer0_hw->timelr = (uint32_t)us;
+    timer0_hw->timehr = (uint32_t)(us >> 32);
+    if (m33_hw->dwt_ctrl & M33_DWT_CTRL_CYCCNTENA_BITS) {
+        uint64_t mhz = SIM_CLK_SYS_HZ / 1000000;
+        m33_hw->dwt_cyccnt += (uint32_t)(t * mhz / 1000 - cyccnt_ns * mhz / 1000);
+    }
+    cyccnt_ns = t;
+    if (t >= sim_end_ns()) sim_finish();
+}
+
+void sim_gpio_press(uint gpio);
+
+// Fire every source that is due now
+static void fire_events(void) {
+    uint64_t now = sim_now_ns;
+    if (sim_timer_next() <= now) sim_timer_fire();
+    if (sim_pwm_next() <= now) sim_pwm_fire();
+    if (sim_dma_next() <= now) sim_dma_fire();
+    while (sim_uart_next() <= now) sim_uart_fire();
+    if (press_next_ns && press_next_ns <= now) {
+        sim_gpio_press(SIM_BUTTON_NEXT);
+        sim_press_ns = now;
+        press_next_ns += sim_opt.press_ms * 1000000ull;
+        bounce_left = sim_opt.bounce;
+        bounce_next_ns = bounce_left ? now + SIM_BOUNCE_NS : UINT64_MAX;
+    } else if (bounce_next_ns <= now) {
+        // The contacts opening and closing again right after the press
+        sim_gpio_press(SIM_BUTTON_NEXT);
+        bounce_next_ns = --bounce_left ? now + SIM_BOUNCE_NS : UINT64_MAX;
+    }
+    if (!capture_done_ns && sim_uart_done()) capture_done_ns = now;
+    event_count++;
+}
+
+void sim_advance(uint64_t ns) {
+    uint64_t target = sim_now_ns + ns;
+    for (;;) {
+        uint64_t next = next_event();
+        if (next > target) break;
+        set_time(next);
+        fire_events();
+        sim_dispatch();
+    }
+    set_time(target);
+    sim_dispatch();
+}
+
+// True if the idle core has something to wake up for: its deadline passed
+// or an event or interrupt happened since it went idle
+static bool irq_pending(uint core);
+
+static bool core_ready(uint core) {
+    return core_wake[core] <= sim_now_ns || core_idle_events[core] != event_count ||
+           (core_wfi[core] && irq_pending(core));
+}
+
+void sim_wait_until(uint64_t deadline) {
+    uint me = core_running;
+    if (core_in_handler[core_current] || core_current != me) {
+        // Waiting inside a handler: nothing else can run on this core
+        sim_advance(deadline == UINT64_MAX ? 1000 : (deadline > sim_now_ns ? deadline - sim_now_ns : 0));
+        return;
+    }
+    core_idle[me] = true;
+    core_wake[me] = deadline;
+    core_idle_events[me] = event_count;
+    uint other = 1 - me;
+    if (core1_launched && (!core_idle[other] || core_ready(other))) {
+        switch_to(other);
+        core_idle[me] = false;
+        return;
+    }
+
+    // Both cores wait: jump to whatever comes first
+    uint64_t next = next_event();
+    if (core_wake[0] < next) next = core_wake[0];
+    if (core1_launched && core_wake[1] < next) next = core_wake[1];
+    sim_advance(next > sim_now_ns ? next - sim_now_ns : 0);
+    core_idle[me] = false;
+}
+
+void sim_poll_point(void) {
+    sim_advance(1000);  // A polling loop iteration costs about a microsecond
+    uint other = 1 - core_running;
+    if (!core1_launched || core_in_handler[core_current] || !core_idle[other]) return;
+    if (core_ready(other)) switch_to(other);
+}
+
+void tight_loop_contents(void) {
+    sim_wait_until(UINT64_MAX);
+}
+
+// Wakes on any interrupt pending for this core, masked or not, like the
+// Cortex-M33 WFI; the masked case lets the caller look again before it runs
+void __wfi(void) {
+    uint me = core_current;
+    if (irq_pending(me)) return;
+    core_wfi[me] = core_asleep[me] = true;
+    sim_wait_until(UINT64_MAX);
+    core_wfi[me] = core_asleep[me] = false;
+}
+
+void __wfe(void) {
+    uint me = core_current;
+    core_asleep[me] = true;
+    sim_wait_until(UINT64_MAX);
+    core_asleep[me] = false;
+}
+
+void __sev(void) {
+    event_count++;
+}
+
+absolute_time_t get_absolute_time(void) {
+    sim_poll_point();
+    return sim_now_ns / 1000;
+}
+
+uint64_t time_us_64(void) {
+    return get_absolute_time();
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)get_absolute_time();
+}
+
+void sleep_us(uint64_t us) {
+    uint me = core_current;
+    uint64_t deadline = sim_now_ns + us * 1000;
+    core_asleep[me] = !core_in_handler[me];  // Handlers busy-wait
+    while (sim_now_ns < deadline) sim_wait_until(deadline);
+    core_asleep[me] = false;
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us(ms * 1000ull);
+}
+
+void busy_wait_us(uint64_t us) {
+    sim_advance(us * 1000);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Interrupts
+// Lines are recomputed from peripheral state on every dispatch, so a handler
+// that does not clear its source runs again, as on hardware.
+
+static irq_handler_t irq_handlers[SIM_IRQ_COUNT];
+static bool irq_enabled[SIM_IRQ_COUNT];
+static uint irq_core[SIM_IRQ_COUNT];
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) {
+    irq_handlers[num] = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled) {
+    irq_enabled[num] = enabled;
+    irq_core[num] = core_current;  // NVIC enables are per core
+    if (enabled) sim_dispatch();
+}
+
+void irq_set_priority(uint num, uint8_t priority) {
+    (void)num;
+    (void)priority;
+}
+
+static bool irq_line(uint num) {
+    switch (num) {
+        case TIMER0_IRQ_0: case TIMER0_IRQ_1: case TIMER0_IRQ_2: case TIMER0_IRQ_3:
+            return sim_timer_line(num);
+        case PWM_IRQ_WRAP_0: case PWM_IRQ_WRAP_1:
+            return sim_pwm_line(num);
+        case DMA_IRQ_0: case DMA_IRQ_1:
+            return sim_dma_line(num);
+        case IO_IRQ_BANK0:
+            return sim_gpio_line();
+        case UART1_IRQ:
+            return sim_uart_line();
+        default:
+            return false;
+    }
+}
+
+static bool irq_pending(uint core) {
+    for (uint num = 0; num < SIM_IRQ_COUNT; num++) {
+        if (irq_enabled[num] && irq_core[num] == core && irq_line(num)) return true;
+    }
+    return false;
+}
+
+void sim_dispatch(void) {
+    bool ran;
+    do {
+        ran = false;
+        for (uint num = 0; num < SIM_IRQ_COUNT; num++) {
+            if (!irq_enabled[num]) continue;
+            uint core = irq_core[num];
+            if (core_masked[core] || core_in_handler[core] || !irq_line(num)) continue;
+
+            uint prev = core_current;
+            core_current = core;
+            core_in_handler[core] = true;
+            if (num == TIMER0_IRQ_0 || num == TIMER0_IRQ_1 || num == TIMER0_IRQ_2 || num == TIMER0_IRQ_3) {
+                timer0_hw->intr = 0;
+            }
+            if (num == PWM_IRQ_WRAP_0 || num == PWM_IRQ_WRAP_1) pwm_hw->intr = 0;
+
+            if (num == IO_IRQ_BANK0) {
+                sim_gpio_dispatch();
+            } else if (irq_handlers[num]) {
+                irq_handlers[num]();
+            }
+
+            if (num <= TIMER0_IRQ_3) sim_timer_ack(num);
+            if (num == PWM_IRQ_WRAP_0 || num == PWM_IRQ_WRAP_1) sim_pwm_ack();
+            core_in_handler[core] = false;
+            core_current = prev;
+            ran = true;
+            event_count++;
+        }
+    } while (ran);
+}
+
+uint32_t save_and_disable_interrupts(void) {
+    uint32_t was = core_masked[core_current];
+    core_masked[core_current] = true;
+    return was;
+}
+
+void restore_interrupts(uint32_t status) {
+    core_masked[core_current] = status != 0;
+    if (!status) sim_dispatch();
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// TIMER0
+// An alarm is armed when its register holds a value it has not fired at yet
+
+static timer_hw_t timer0_regs;
+timer_hw_t* const timer0_hw = &timer0_regs;
+static uint32_t timer_raw_intr = 0;
+static uint32_t timer_fired[4];
+
+static bool alarm_armed(uint n) {
+    return timer0_regs.alarm[n] != timer_fired[n];
+}
+
+uint64_t sim_timer_next(void) {
+    uint64_t next = UINT64_MAX;
+    uint32_t now_us = (uint32_t)(sim_now_ns / 1000);
+    for (uint n = 0; n < 4; n++) {
+        if (!alarm_armed(n)) continue;
+        int32_t ahead = (int32_t)(timer0_regs.alarm[n] - now_us);
+        uint64_t t = ahead <= 0 ? sim_now_ns : (sim_now_ns / 1000 + ahead) * 1000;
+        if (t < next) next = t;
+    }
+    return next;
+}
+
+void sim_timer_fire(void) {
+    uint32_t now_us = (uint32_t)(sim_now_ns / 1000);
+    for (uint n = 0; n < 4; n++) {
+        if (alarm_armed(n) && (int32_t)(timer0_regs.alarm[n] - now_us) <= 0) {
+            timer_fired[n] = timer0_regs.alarm[n];
+            timer_raw_intr |= 1u << n;
+        }
+    }
+}
+
+bool sim_timer_line(uint num) {
+    return timer_raw_intr & timer0_regs.inte & (1u << num);
+}
+
+// The handler acknowledges by writing intr (write-1-to-clear on hardware)
+void sim_timer_ack(uint num) {
+    (void)num;
+    timer_raw_intr &= ~timer0_regs.intr;
+    timer0_regs.intr = timer_raw_intr;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// PWM: only the wrap interrupt is modeled
+
+static pwm_hw_t pwm_regs;
+pwm_hw_t* const pwm_hw = &pwm_regs;
+static uint32_t pwm_raw_intr = 0;
+static uint64_t pwm_next_wrap[NUM_PWM_SLICES];
+
+static uint64_t pwm_period_ns(uint slice) {
+    uint32_t div = pwm_regs.slice[slice].div ? pwm_regs.slice[slice].div : 16;  // 8.4 fixed point
+    return (uint64_t)(pwm_regs.slice[slice].top + 1) * div * 1000000000ull / 16 / SIM_CLK_SYS_HZ;
+}
+
+void pwm_set_clkdiv(uint slice_num, float divider) {
+    pwm_regs.slice[slice_num].div = (uint32_t)(divider * 16);
+}
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap) {
+    pwm_regs.slice[slice_num].top = wrap;
+}
+
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level) {
+    uint32_t cc = pwm_regs.slice[slice_num].cc;
+    pwm_regs.slice[slice_num].cc = chan ? (cc & 0xFFFF) | (uint32_t)level << 16 : (cc & 0xFFFF0000) | level;
+}
+
+void pwm_set_both_levels(uint slice_num, uint16_t level_a, uint16_t level_b) {
+    pwm_regs.slice[slice_num].cc = (uint32_t)level_b << 16 | level_a;
+}
+
+void pwm_set_enabled(uint slice_num, bool enabled) {
+    pwm_regs.slice[slice_num].csr = enabled;
+    pwm_next_wrap[slice_num] = sim_now_ns + pwm_period_ns(slice_num);
+}
+
+void pwm_set_irq0_enabled(uint slice_num, bool enabled) {
+    if (enabled) pwm_regs.irq0_inte |= 1u << slice_num;
+    else pwm_regs.irq0_inte &= ~(1u << slice_num);
+}
+
+void pwm_set_irq1_enabled(uint slice_num, bool enabled) {
+    if (enabled) pwm_regs.irq1_inte |= 1u << slice_num;
+    else pwm_regs.irq1_inte &= ~(1u << slice_num);
+}
+
+uint64_t sim_pwm_next(void) {
+    uint64_t next = UINT64_MAX;
+    for (uint s = 0; s < NUM_PWM_SLICES; s++) {
+        if (pwm_regs.slice[s].csr & 1 && pwm_next_wrap[s] < next) next = pwm_next_wrap[s];
+    }
+    return next;
+}
+
+void sim_pwm_fire(void) {
+    for (uint s = 0; s < NUM_PWM_SLICES; s++) {
+        if (!(pwm_regs.slice[s].csr & 1) || pwm_next_wrap[s] > sim_now_ns) continue;
+        pwm_raw_intr |= 1u << s;
+        pwm_next_wrap[s] = sim_now_ns + pwm_period_ns(s);
+    }
+}
+
+bool sim_pwm_line(uint num) {
+    uint32_t inte = num == PWM_IRQ_WRAP_0 ? pwm_regs.irq0_inte : pwm_regs.irq1_inte;
+    return pwm_raw_intr & inte;
+}
+
+void sim_pwm_ack(void) {
+    pwm_raw_intr &= ~pwm_regs.intr;
+    pwm_regs.intr = pwm_raw_intr;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// GPIO: output levels (read by the SPI decoder) and edge events for buttons
+
+#define SIM_GPIO_COUNT 48
+
+static bool gpio_out[SIM_GPIO_COUNT];
+static uint32_t gpio_irq_mask[SIM_GPIO_COUNT];
+static uint32_t gpio_events[SIM_GPIO_COUNT];
+
+#define SIM_RAW_HANDLERS 8
+static struct {
+    uint64_t mask;
+    irq_handler_t handler;
+} gpio_raw[SIM_RAW_HANDLERS];
+static gpio_irq_callback_t gpio_callback = NULL;
+
+void gpio_init(uint gpio) { gpio_out[gpio] = false; }
+void gpio_set_function(uint gpio, uint fn) { (void)gpio; (void)fn; }
+void gpio_set_dir(uint gpio, bool out) { (void)gpio; (void)out; }
+void gpio_put(uint gpio, bool value) { gpio_out[gpio] = value; }
+bool gpio_get(uint gpio) { return gpio_out[gpio]; }
+void gpio_pull_up(uint gpio) { (void)gpio; }
+void gpio_pull_down(uint gpio) { (void)gpio; }
+
+bool sim_gpio_level(uint gpio) {
+    return gpio_out[gpio];
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) {
+    if (enabled) gpio_irq_mask[gpio] |= event_mask;
+    else gpio_irq_mask[gpio] &= ~event_mask;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback) {
+    gpio_callback = callback;
+    gpio_set_irq_enabled(gpio, event_mask, enabled);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+void gpio_add_raw_irq_handler_masked(uint64_t gpio_mask, irq_handler_t handler) {
+    for (int i = 0; i < SIM_RAW_HANDLERS; i++) {
+        if (!gpio_raw[i].handler) {
+            gpio_raw[i].mask = gpio_mask;
+            gpio_raw[i].handler = handler;
+            return;
+        }
+    }
+}
+
+uint32_t gpio_get_irq_event_mask(uint gpio) {
+    return gpio_events[gpio] & gpio_irq_mask[gpio];
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask) {
+    gpio_events[gpio] &= ~event_mask;
+}
+
+// A press and release: rising edge, then falling edge (active high buttons)
+void sim_gpio_press(uint gpio) {
+    gpio_events[gpio] |= GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL;
+}
+
+bool sim_gpio_line(void) {
+    for (uint g = 0; g < SIM_GPIO_COUNT; g++) {
+        if (gpio_events[g] & gpio_irq_mask[g]) return true;
+    }
+    return false;
+}
+
+// Edge events nobody enabled are dropped, as the hardware never latches them
+void sim_gpio_dispatch(void) {
+    for (uint g = 0; g < SIM_GPIO_COUNT; g++) {
+        gpio_events[g] &= gpio_irq_mask[g];
+        if (!gpio_events[g]) continue;
+        bool handled = false;
+        for (int i = 0; i < SIM_RAW_HANDLERS; i++) {
+            if (gpio_raw[i].handler && (gpio_raw[i].mask & (1ull << g))) {
+                gpio_raw[i].handler();
+                handled = true;
+            }
+        }
+        if (!handled && gpio_callback) {
+            uint32_t events = gpio_events[g];
+            gpio_events[g] = 0;
+            gpio_callback(g, events);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Flash: NOR semantics (erase to 0xFF, program can only clear bits)
+// Erase and program take typical W25Q128 times with interrupts off
+
+uint8_t sim_flash[PICO_FLASH_SIZE_BYTES];
+#define SIM_FLASH_ERASE_NS 45000000ull   // 4 KB sector erase
+#define SIM_FLASH_PROGRAM_NS 700000ull   // 256 byte page program
+
+static struct {
+    uint32_t erases, programs;
+    uint64_t locked_ns, locked_max_ns;  // Cores held off flash by flash_safe_execute
+    uint32_t overruns;                  // uart1 RX overruns meanwhile
+    uint32_t records;                   // Track records programmed
+    uint32_t first_records;             // Of those, in the first page
+    uint64_t first_ns, last_ns;         // First and last track page program
+} flash_stats;
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+    flash_stats.erases += count / FLASH_SECTOR_SIZE;
+    memset(sim_flash + flash_offs, 0xFF, count);
+    sim_advance(count / FLASH_SECTOR_SIZE * SIM_FLASH_ERASE_NS);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t* data, size_t count) {
+    flash_stats.programs += count / FLASH_PAGE_SIZE;
+    for (size_t i = 0; i < count; i++) sim_flash[flash_offs + i] &= data[i];
+    sim_advance(count / FLASH_PAGE_SIZE * SIM_FLASH_PROGRAM_NS);
+}
+
+int flash_safe_execute(void (*func)(void*), void* param, uint32_t enter_exit_timeout_ms) {
+    (void)enter_exit_timeout_ms;
+    // Both cores are held off flash: mask them for the duration
+    bool masked0 = core_masked[0], masked1 = core_masked[1];
+    core_masked[0] = core_masked[1] = true;
+    uint64_t start = sim_now_ns;
+    uint32_t overruns = sim_uart_overruns();
+    func(param);
+    uint64_t locked = sim_now_ns - start;
+    flash_stats.locked_ns += locked;
+    if (locked > flash_stats.locked_max_ns) flash_stats.locked_max_ns = locked;
+    flash_stats.overruns += sim_uart_overruns() - overruns;
+    core_masked[0] = masked0;
+    core_masked[1] = masked1;
+    sim_dispatch();
+    return PICO_OK;
+}
+
+bool flash_safe_execute_core_init(void) {
+    return true;
+}
+
+void sim_flash_load(void) {
+    memset(sim_flash, sim_opt.dirty_flash ? 0x00 : 0xFF, sizeof(sim_flash));
+    if (!sim_opt.flash_path) return;
+    FILE* f = fopen(sim_opt.flash_path, "rb");
+    if (!f) return;
+    size_t n = fread(sim_flash, 1, sizeof(sim_flash), f);
+    (void)n;
+    fclose(f);
+}
+
+// Count the records in a track log page; slot 0 of a sector is its header
+void sim_track_program(uint32_t offset, const uint8_t* page) {
+    uint32_t records = 0;
+    for (uint32_t i = 0; i < FLASH_PAGE_SIZE; i += 16) {
+        if ((offset + i) % FLASH_SECTOR_SIZE == 0) continue;
+        for (uint32_t j = 0; j < 16; j++) {
+            if (page[i + j] != 0xFF) {
+                records++;
+                break;
+            }
+        }
+    }
+    if (!flash_stats.first_ns) {
+        flash_stats.first_ns = sim_now_ns;
+        flash_stats.first_records = records;
+    }
+    flash_stats.last_ns = sim_now_ns;
+    flash_stats.records += records;
+}
+
+void sim_flash_report(void) {
+    fprintf(sim_log, "\nflash: %u sector erases, %u page programs; cores held off flash %.1f ms in all, "
+            "%.1f ms longest, %u uart1 RX overruns meanwhile\n", flash_stats.erases, flash_stats.programs,
+            flash_stats.locked_ns / 1e6, flash_stats.locked_max_ns / 1e6, flash_stats.overruns);
+    if (flash_stats.last_ns > flash_stats.first_ns) {
+        double per_fix_ns = (double)flash_stats.locked_ns / flash_stats.records;
+        fprintf(sim_log, "track log: %u fixes committed to flash, %.2f per second sustained (first to last page); "
+                "flash busy %.3f ms per fix with erases, room for %.0f fixes per second\n", flash_stats.records,
+                (flash_stats.records - flash_stats.first_records) * 1e9 / (flash_stats.last_ns - flash_stats.first_ns),
+                per_fix_ns / 1e6, 1e9 / per_fix_ns);
+    }
+}
+
+void sim_flash_save(void) {
+    if (!sim_opt.flash_path) return;
+    FILE* f = fopen(sim_opt.flash_path, "wb");
+    if (!f) return;
+    fwrite(sim_flash, 1, sizeof(sim_flash), f);
+    fclose(f);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Odds and ends: stdio, USB (never connected), random numbers, ADC
+
+struct stdio_driver { int unused; };
+stdio_driver_t stdio_usb;
+
+bool stdio_init_all(void) { return true; }
+int getchar_timeout_us(uint32_t timeout_us) { sim_advance(timeout_us * 1000ull); return PICO_ERROR_TIMEOUT; }
+void stdio_set_driver_enabled(stdio_driver_t* driver, bool enabled) { (void)driver; (void)enabled; }
+
+bool tud_cdc_connected(void) { sim_poll_point(); return false; }  // Polled by every USB task run
+uint32_t tud_cdc_available(void) { return 0; }
+int32_t tud_cdc_read_char(void) { return -1; }
+uint32_t tud_cdc_write_available(void) { return 0; }
+uint32_t tud_cdc_write(const void* buffer, uint32_t size) { (void)buffer; (void)size; return 0; }
+uint32_t tud_cdc_write_flush(void) { return 0; }
+
+uint32_t get_rand_32(void) {
+    static uint32_t state = 2463534242u;  // xorshift32, fixed seed so runs repeat
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+void adc_init(void) {}
+void adc_gpio_init(uint gpio) { (void)gpio; }
+void adc_select_input(uint input) { (void)input; }
+uint16_t adc_read(void) { return 0; }
+
+uint32_t clock_get_hz(enum clock_num clk_index) {
+    return clk_index == clk_peri ? SIM_CLK_PERI_HZ : SIM_CLK_SYS_HZ;
+}
+
+static m33_hw_t m33_regs;
+m33_hw_t* const m33_hw = &m33_regs;
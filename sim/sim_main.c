@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+
+// Entry point of the host simulation
+// The firmware's main() is renamed firmware_main by the native build flags.
+#undef main
+
+int firmware_main(void);
+
+sim_options_t sim_opt = { .gps_baud = 9600 };
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  --nmea FILE      NMEA capture replayed by the simulated GPS\n"
+            "  --loop           replay the capture forever (use with --seconds)\n"
+            "  --gps-baud N     rate the GPS module starts at (default 9600)\n"
+            "  --seconds S      simulated run time (default: until the capture ends)\n"
+            "  --press MS       press the next-page button every MS milliseconds\n"
+            "  --bounce N       follow each press with N bounces, 300 us apart\n"
+            "  --ppm DIR        write the panel to DIR/<page>.ppm after each draw, and the\n"
+            "                   firmware framebuffer to DIR/<page>.fb.ppm\n"
+            "  --flash FILE     keep the 16 MB flash in FILE between runs\n"
+            "  --dirty-flash    start from flash that is programmed, not erased, so every\n"
+            "                   sector the firmware writes must be erased first\n"
+            "  --quiet          hide the firmware's printf output\n"
+            "  --replay FILE    benchmark the NMEA parser on FILE instead of running the firmware\n",
+            argv0);
+    exit(2);
+}
+
+void sim_finish(void) {
+    static bool finishing = false;
+    if (finishing) return;
+    finishing = true;
+    fflush(stdout);
+    fprintf(sim_log, "\nSimulated %.3f s\n", sim_now_ns / 1e9);
+    sim_cpu_report();
+    sim_spi_report();
+    sim_uart_report();
+    sim_flash_report();
+    sim_flash_save();
+    exit(0);
+}
+
+int main(int argc, char** argv) {
+    sim_log = stderr;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* val = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(arg, "--loop") == 0) { sim_opt.nmea_loop = true; continue; }
+        if (strcmp(arg, "--quiet") == 0) { sim_opt.quiet = true; continue; }
+        if (strcmp(arg, "--dirty-flash") == 0) { sim_opt.dirty_flash = true; continue; }
+        if (!val) usage(argv[0]);
+        if (strcmp(arg, "--nmea") == 0) sim_opt.nmea_path = val;
+        else if (strcmp(arg, "--gps-baud") == 0) sim_opt.gps_baud = strtoul(val, NULL, 10);
+        else if (strcmp(arg, "--seconds") == 0) sim_opt.seconds = atof(val);
+        else if (strcmp(arg, "--press") == 0) sim_opt.press_ms = strtoul(val, NULL, 10);
+        else if (strcmp(arg, "--bounce") == 0) sim_opt.bounce = strtoul(val, NULL, 10);
+        else if (strcmp(arg, "--ppm") == 0) sim_opt.ppm_dir = val;
+        else if (strcmp(arg, "--flash") == 0) sim_opt.flash_path = val;
+        else if (strcmp(arg, "--replay") == 0) return sim_replay(val);
+        else usage(argv[0]);
+        i++;
+    }
+    if (sim_opt.quiet && !freopen("/dev/null", "w", stdout)) return 1;
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    sim_flash_load();
+    sim_uart_load();
+    firmware_main();
+    sim_finish();
+    return 0;
+}
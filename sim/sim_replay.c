@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <time.h>
+#include "sim.h"
+#include "nmea.h"
+
+// NMEA parser benchmark (--replay FILE)
+// Feeds a recorded capture through nmea_feed byte by byte, as gps_poll does,
+// for at least a second of host time and reports the sustained rate. The
+// callbacks only touch what they are given, so the figure is the parser's own
+// cost. Runs instead of the firmware, off the simulated clock.
+
+#define REPLAY_MIN_NS 1000000000ull
+
+static uint32_t replay_fields;
+static uint32_t replay_bytes;  // Field text seen by on_field, keeps it from being optimised out
+
+static void replay_on_field(nmea_sentence_t type, uint8_t index, const char* text, uint8_t len) {
+    (void)type;
+    (void)index;
+    (void)text;
+    replay_fields++;
+    replay_bytes += len;
+}
+
+static void replay_on_sentence(nmea_sentence_t type, bool valid) {
+    (void)type;
+    (void)valid;
+}
+
+static uint64_t host_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+int sim_replay(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(sim_log, "sim: cannot open %s\n", path);
+        return 1;
+    }
+    size_t cap = 1 << 16, len = 0;
+    char* data = malloc(cap);
+    size_t got;
+    while (data && (got = fread(data + len, 1, cap - len, f)) > 0) {
+        len += got;
+        if (len == cap) data = realloc(data, cap *= 2);
+    }
+    fclose(f);
+    if (!data || len == 0) {
+        fprintf(sim_log, "sim: nothing to replay in %s\n", path);
+        free(data);
+        return 1;
+    }
+
+    nmea_parser_t parser;
+    nmea_init(&parser, replay_on_field, replay_on_sentence);
+    for (size_t i = 0; i < len; i++) nmea_feed(&parser, data[i]);
+    uint32_t good = parser.sentences, bad = parser.checksum_errors;
+
+    uint64_t passes = 0, start = host_ns(), elapsed;
+    do {
+        nmea_init(&parser, replay_on_field, replay_on_sentence);
+        for (size_t i = 0; i < len; i++) nmea_feed(&parser, data[i]);
+        passes++;
+        elapsed = host_ns() - start;
+    } while (elapsed < REPLAY_MIN_NS);
+    free(data);
+
+    double seconds = elapsed / 1e9;
+    fprintf(sim_log, "replay: %s, %zu bytes, %u sentences (%u rejected), %u fields per pass\n",
+            path, len, good, bad, replay_fields / (uint32_t)(passes + 1));
+    fprintf(sim_log, "parser: %.0f sentences/s, %.1f MB/s over %llu passes in %.2f s (host)\n",
+            (double)good * passes / seconds, (double)len * passes / seconds / 1e6,
+            (unsigned long long)passes, seconds);
+    fprintf(sim_log, "parser RAM: %zu bytes (nmea_parser_t, %d byte field buffer), no sentence buffer\n",
+            sizeof(nmea_parser_t), NMEA_FIELD_MAX + 1);
+    return 0;
+}
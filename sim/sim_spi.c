@@ -0,0 +1,567 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "hardware/spi.h"
+#include "hardware/dma.h"
+
+// spi0 and DMA feeding an ILI9341 decoder, and the per-page frame report
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 320
+
+//////////////////////////////////////////////////////////////////////////////
+
+// SPI
+
+struct spi_inst { spi_hw_t hw; uint baud; uint data_bits; };
+static struct spi_inst spi_units[2];
+spi_inst_t* const spi0 = &spi_units[0];
+spi_inst_t* const spi1 = &spi_units[1];
+
+static uint64_t spi_wire_ns = 0;     // Bus time since the last frame report
+static uint64_t spi_stray_bytes = 0; // Sent with CS high
+
+// Divider limits as on hardware: at most clk_peri / 2
+uint spi_set_baudrate(spi_inst_t* spi, uint baudrate) {
+    uint max = SIM_CLK_PERI_HZ / 2;
+    spi->baud = baudrate > max ? max : baudrate;
+    return spi->baud;
+}
+
+uint spi_init(spi_inst_t* spi, uint baudrate) {
+    spi->data_bits = 8;
+    return spi_set_baudrate(spi, baudrate);
+}
+
+void spi_set_format(spi_inst_t* spi, uint data_bits, spi_cpol_t cpol, spi_cpha_t cpha, spi_order_t order) {
+    (void)cpol;
+    (void)cpha;
+    (void)order;
+    spi->data_bits = data_bits;
+}
+
+bool spi_is_busy(spi_inst_t* spi) { (void)spi; return false; }
+bool spi_is_readable(spi_inst_t* spi) { (void)spi; return false; }
+spi_hw_t* spi_get_hw(spi_inst_t* spi) { return &spi->hw; }
+uint spi_get_dreq(spi_inst_t* spi, bool is_tx) { return (spi == spi1) * 2 + !is_tx; }
+
+static uint64_t spi_frame_ns(uint frames) {
+    uint baud = spi0->baud ? spi0->baud : 1000000;
+    return (uint64_t)frames * spi0->data_bits * 1000000000ull / baud;
+}
+
+static void panel_byte(uint8_t b, bool data);
+
+void sim_spi_bytes(const uint8_t* data, size_t len) {
+    bool dc = sim_gpio_level(SIM_DISP_DC);
+    for (size_t i = 0; i < len; i++) {
+        if (sim_gpio_level(SIM_SPI_CSN)) {
+            spi_stray_bytes++;
+            continue;
+        }
+        panel_byte(data[i], dc);
+    }
+}
+
+int spi_write_blocking(spi_inst_t* spi, const uint8_t* src, size_t len) {
+    if (spi != spi0) return (int)len;
+    sim_spi_bytes(src, len);
+    uint64_t ns = spi_frame_ns(len);
+    spi_wire_ns += ns;
+    sim_advance(ns);
+    return (int)len;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// DMA
+// A transfer into spi0's data register is decoded when it starts and
+// completes after its wire time. A transfer paced by a UART RX DREQ runs as
+// bytes arrive (sim_dma_rx), whatever the cores are doing. Other transfers
+// copy memory instantly.
+
+#define SIM_DMA_CHANNELS 16
+#define SIM_DREQ_UART_RX(index) (4 + (index) * 2 + 1)  // As uart_get_dreq_num numbers them
+
+static struct {
+    bool claimed;
+    bool busy;
+    bool paced;              // Waiting on its DREQ, see sim_dma_rx
+    bool irq0_enabled;
+    bool irq0_raw;
+    uint64_t end_ns;
+    dma_channel_config config;
+    dma_channel_hw_t hw;
+} dma_ch[SIM_DMA_CHANNELS];
+
+int dma_claim_unused_channel(bool required) {
+    for (int i = 0; i < SIM_DMA_CHANNELS; i++) {
+        if (!dma_ch[i].claimed) {
+            dma_ch[i].claimed = true;
+            return i;
+        }
+    }
+    if (required) abort();
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+    dma_channel_config c = { 1u | DMA_SIZE_32 << 2 };  // Read increment, 32-bit
+    return c;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config* c, enum dma_channel_transfer_size size) {
+    c->ctrl = (c->ctrl & ~0xCu) | (uint32_t)size << 2;
+}
+
+void channel_config_set_read_increment(dma_channel_config* c, bool incr) {
+    c->ctrl = (c->ctrl & ~1u) | incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config* c, bool incr) {
+    c->ctrl = (c->ctrl & ~2u) | (uint32_t)incr << 1;
+}
+
+void channel_config_set_dreq(dma_channel_config* c, uint dreq) {
+    c->ctrl = (c->ctrl & ~0xFF00u) | (dreq & 0xFF) << 8;
+}
+
+void channel_config_set_ring(dma_channel_config* c, bool write, uint size_bits) {
+    c->ctrl = (c->ctrl & ~0x100F0u) | (size_bits & 0xF) << 4 | (uint32_t)write << 16;
+}
+
+dma_channel_hw_t* dma_channel_hw_addr(uint channel) {
+    return &dma_ch[channel].hw;
+}
+
+// Start a channel whose registers are already set
+static void dma_start(uint channel) {
+    uint dreq = (dma_ch[channel].config.ctrl >> 8) & 0xFF;
+    if (dreq == SIM_DREQ_UART_RX(1)) {
+        dma_ch[channel].busy = dma_ch[channel].hw.transfer_count != 0;
+        dma_ch[channel].paced = true;
+        dma_ch[channel].end_ns = UINT64_MAX;
+        return;
+    }
+    dma_channel_configure(channel, &dma_ch[channel].config, (volatile void*)dma_ch[channel].hw.write_addr,
+                          (const volatile void*)dma_ch[channel].hw.read_addr, dma_ch[channel].hw.transfer_count, true);
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void* write_addr, bool trigger) {
+    dma_ch[channel].hw.write_addr = (uintptr_t)write_addr;
+    if (trigger) dma_start(channel);
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger) {
+    dma_ch[channel].hw.transfer_count = trans_count;
+    if (trigger) dma_start(channel);
+}
+
+void dma_channel_abort(uint channel) {
+    dma_ch[channel].busy = false;
+    dma_ch[channel].paced = false;
+}
+
+// A byte for a DREQ-paced channel; false if no running channel takes it
+bool sim_dma_rx(uint dreq, uint8_t b) {
+    for (int i = 0; i < SIM_DMA_CHANNELS; i++) {
+        if (!dma_ch[i].busy || !dma_ch[i].paced || ((dma_ch[i].config.ctrl >> 8) & 0xFF) != dreq) continue;
+        uintptr_t addr = dma_ch[i].hw.write_addr;
+        *(volatile uint8_t*)addr = b;
+        uintptr_t ring = (dma_ch[i].config.ctrl & 0x10000u) ? ((uintptr_t)1 << ((dma_ch[i].config.ctrl >> 4) & 0xF)) - 1 : 0;
+        if (dma_ch[i].config.ctrl & 2) addr = ring ? (addr & ~ring) | ((addr + 1) & ring) : addr + 1;
+        dma_ch[i].hw.write_addr = addr;
+        if (--dma_ch[i].hw.transfer_count == 0) {
+            dma_ch[i].busy = false;
+            dma_ch[i].irq0_raw = true;
+        }
+        return true;
+    }
+    return false;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config* config, volatile void* write_addr,
+                           const volatile void* read_addr, uint32_t transfer_count, bool trigger) {
+    dma_ch[channel].config = *config;
+    dma_ch[channel].hw.write_addr = (uintptr_t)write_addr;
+    dma_ch[channel].hw.read_addr = (uintptr_t)read_addr;
+    dma_ch[channel].hw.transfer_count = transfer_count;
+    if (!trigger) return;
+    if ((config->ctrl >> 8 & 0xFF) == SIM_DREQ_UART_RX(1)) {
+        dma_start(channel);
+        return;
+    }
+    uint size = 1u << ((config->ctrl >> 2) & 3);
+    bool read_incr = config->ctrl & 1;
+    const volatile uint8_t* src = read_addr;
+
+    if (write_addr == &spi0->hw.dr) {
+        for (uint32_t i = 0; i < transfer_count; i++) {
+            const volatile uint8_t* p = src + (read_incr ? i * size : 0);
+            uint32_t value = size == 1 ? *p : size == 2 ? *(const volatile uint16_t*)p : *(const volatile uint32_t*)p;
+            if (spi0->data_bits > 8) {
+                uint8_t bytes[2] = { (uint8_t)(value >> 8), (uint8_t)value };
+                sim_spi_bytes(bytes, 2);
+            } else {
+                uint8_t byte = (uint8_t)value;
+                sim_spi_bytes(&byte, 1);
+            }
+        }
+        uint64_t ns = spi_frame_ns(transfer_count);
+        spi_wire_ns += ns;
+        dma_ch[channel].busy = true;
+        dma_ch[channel].end_ns = sim_now_ns + ns;
+        return;
+    }
+
+    volatile uint8_t* dst = write_addr;
+    bool write_incr = config->ctrl & 2;
+    for (uint32_t i = 0; i < transfer_count; i++) {
+        memcpy((void*)(dst + (write_incr ? i * size : 0)), (const void*)(src + (read_incr ? i * size : 0)), size);
+    }
+    dma_ch[channel].busy = true;
+    dma_ch[channel].end_ns = sim_now_ns;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) {
+    dma_ch[channel].irq0_enabled = enabled;
+}
+
+void dma_channel_acknowledge_irq0(uint channel) {
+    dma_ch[channel].irq0_raw = false;
+}
+
+bool dma_channel_is_busy(uint channel) {
+    return dma_ch[channel].busy;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel) {
+    while (dma_ch[channel].busy) sim_wait_until(dma_ch[channel].end_ns);
+}
+
+uint64_t sim_dma_next(void) {
+    uint64_t next = UINT64_MAX;
+    for (int i = 0; i < SIM_DMA_CHANNELS; i++) {
+        if (dma_ch[i].busy && dma_ch[i].end_ns < next) next = dma_ch[i].end_ns;
+    }
+    return next;
+}
+
+void sim_dma_fire(void) {
+    for (int i = 0; i < SIM_DMA_CHANNELS; i++) {
+        if (dma_ch[i].busy && dma_ch[i].end_ns <= sim_now_ns) {
+            dma_ch[i].busy = false;
+            dma_ch[i].irq0_raw = true;
+        }
+    }
+}
+
+bool sim_dma_line(uint num) {
+    if (num != 10) return false;  // DMA_IRQ_0 only
+    for (int i = 0; i < SIM_DMA_CHANNELS; i++) {
+        if (dma_ch[i].irq0_raw && dma_ch[i].irq0_enabled) return true;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// ILI9341 decoder
+// Follows column/page address set and memory write into a 240x320 RGB565
+// panel, plus the few state commands the firmware sends. panel[] is the
+// controller memory; images and hashes show it through the vertical
+// scrolling definition (0x33) and start address (0x37) like the glass would.
+
+static uint16_t panel[PANEL_HEIGHT][PANEL_WIDTH];
+static struct {
+    uint8_t cmd;
+    uint8_t arg[6];
+    uint8_t argc;
+    uint16_t x0, x1, y0, y1;
+    uint16_t scroll_top, scroll_rows, scroll_start;  // 0x33 fixed top / scrolling rows, 0x37
+    uint16_t x, y;
+    int pixel_hi;            // First byte of a pixel, -1 if none
+    bool sleeping;
+    bool on;
+    bool idle;               // 0x39: 8 colours
+    uint64_t mode_ns;        // Since sleeping or idle last changed
+    uint64_t asleep_ns, idle_ns;
+    uint32_t commands;
+    uint32_t unknown;
+} lcd = { .x1 = PANEL_WIDTH - 1, .y1 = PANEL_HEIGHT - 1, .pixel_hi = -1, .sleeping = true,
+          .scroll_rows = PANEL_HEIGHT };
+
+// Add the time since the last change to the sleep and idle totals
+static void panel_mode_account(void) {
+    if (lcd.sleeping) lcd.asleep_ns += sim_now_ns - lcd.mode_ns;
+    else if (lcd.idle) lcd.idle_ns += sim_now_ns - lcd.mode_ns;
+    lcd.mode_ns = sim_now_ns;
+}
+
+// Memory row shown on screen row y
+static int panel_shown_row(int y) {
+    int top = lcd.scroll_top, rows = lcd.scroll_rows;
+    if (y < top || y >= top + rows || rows == 0) return y;
+    return top + (lcd.scroll_start - top + (y - top) + rows) % rows;
+}
+
+static void panel_pixel(uint16_t color) {
+    if (lcd.x < PANEL_WIDTH && lcd.y < PANEL_HEIGHT) panel[lcd.y][lcd.x] = color;
+    if (++lcd.x > lcd.x1) {
+        lcd.x = lcd.x0;
+        if (++lcd.y > lcd.y1) lcd.y = lcd.y0;
+    }
+}
+
+static void panel_byte(uint8_t b, bool data) {
+    if (!data) {
+        lcd.cmd = b;
+        lcd.argc = 0;
+        lcd.commands++;
+        if (b == 0x01 || b == 0x10 || b == 0x11 || b == 0x38 || b == 0x39) panel_mode_account();
+        switch (b) {
+            case 0x2C: lcd.x = lcd.x0; lcd.y = lcd.y0; lcd.pixel_hi = -1; break;  // Memory write
+            case 0x3C: lcd.pixel_hi = -1; break;                                  // Memory write continue
+            case 0x01: lcd.sleeping = true; lcd.on = false; lcd.idle = false; break;  // Software reset
+            case 0x10: lcd.sleeping = true; break;
+            case 0x11: lcd.sleeping = false; break;
+            case 0x28: lcd.on = false; break;
+            case 0x29: lcd.on = true; break;
+            case 0x38: lcd.idle = false; break;
+            case 0x39: lcd.idle = true; break;
+            case 0x2A: case 0x2B: case 0x36: case 0x3A: case 0x33: case 0x37: break;
+            default: lcd.unknown++; break;
+        }
+        return;
+    }
+    switch (lcd.cmd) {
+        case 0x2A:
+        case 0x2B:
+            if (lcd.argc < 4) lcd.arg[lcd.argc++] = b;
+            if (lcd.argc == 4) {
+                uint16_t start = lcd.arg[0] << 8 | lcd.arg[1];
+                uint16_t end = lcd.arg[2] << 8 | lcd.arg[3];
+                if (lcd.cmd == 0x2A) { lcd.x0 = start; lcd.x1 = end; }
+                else { lcd.y0 = start; lcd.y1 = end; }
+            }
+            break;
+        case 0x33:
+            if (lcd.argc < 6) lcd.arg[lcd.argc++] = b;
+            if (lcd.argc == 6) {
+                lcd.scroll_top = lcd.arg[0] << 8 | lcd.arg[1];
+                lcd.scroll_rows = lcd.arg[2] << 8 | lcd.arg[3];
+            }
+            break;
+        case 0x37:
+            if (lcd.argc < 2) lcd.arg[lcd.argc++] = b;
+            if (lcd.argc == 2) lcd.scroll_start = lcd.arg[0] << 8 | lcd.arg[1];
+            break;
+        case 0x2C:
+        case 0x3C:
+            if (lcd.pixel_hi < 0) {
+                lcd.pixel_hi = b;
+            } else {
+                panel_pixel((uint16_t)(lcd.pixel_hi << 8 | b));
+                lcd.pixel_hi = -1;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static uint32_t panel_hash(void) {
+    uint32_t h = 2166136261u;
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        const uint16_t* row = panel[panel_shown_row(y)];
+        for (int x = 0; x < PANEL_WIDTH; x++) {
+            h = (h ^ row[x]) * 16777619u;
+        }
+    }
+    return h;
+}
+
+static void panel_write_ppm(const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return;
+    fprintf(f, "P6\n%d %d\n255\n", PANEL_WIDTH, PANEL_HEIGHT);
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        const uint16_t* row = panel[panel_shown_row(y)];
+        for (int x = 0; x < PANEL_WIDTH; x++) {
+            uint16_t c = row[x];
+            uint8_t rgb[3] = { (uint8_t)((c >> 11) << 3), (uint8_t)(((c >> 5) & 0x3F) << 2), (uint8_t)((c & 0x1F) << 3) };
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    fclose(f);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Frame report
+// spi_stats_report in main.c calls sim_frame_report after every page draw; the
+// counters are aggregated per page label and printed when the run ends.
+
+#define SIM_MAX_PAGES 16
+
+typedef struct {
+    char label[32];
+    uint32_t frames;
+    uint64_t bytes, windows, transactions, wire_ns;
+    uint32_t max_bytes, max_windows;
+    uint64_t max_wire_ns;
+    uint32_t hash;
+} page_stats_t;
+
+static page_stats_t pages[SIM_MAX_PAGES];
+static int page_count = 0;
+
+// Framebuffer against panel memory after each flushed draw
+static struct {
+    uint32_t frames, mismatched;
+    uint32_t max_pixels;       // Most pixels that differed in one frame
+    char first[32];            // Page of the first mismatch
+} fb_check;
+
+// DIR/<label><suffix>.ppm under --ppm, spaces in the label made underscores
+static void ppm_path(char* path, size_t size, const char* label, const char* suffix) {
+    snprintf(path, size, "%s/", sim_opt.ppm_dir);
+    size_t n = strlen(path);
+    for (const char* c = label; *c && n + strlen(suffix) + 5 < size; c++) path[n++] = *c == ' ' ? '_' : *c;
+    snprintf(path + n, size - n, "%s.ppm", suffix);
+}
+
+// Page switches: from the latest button press to the first whole frame of
+// another page
+static struct {
+    page_stats_t* last;
+    uint32_t count;
+    uint64_t total_ns, max_ns;
+} switches;
+
+void sim_frame_report(const char* label, uint32_t transactions, uint32_t bytes, uint32_t windows) {
+    page_stats_t* p = NULL;
+    for (int i = 0; i < page_count; i++) {
+        if (strcmp(pages[i].label, label) == 0) p = &pages[i];
+    }
+    if (!p) {
+        if (page_count == SIM_MAX_PAGES) return;
+        p = &pages[page_count++];
+        snprintf(p->label, sizeof(p->label), "%s", label);
+    }
+    if (switches.last && p != switches.last && sim_press_ns) {
+        uint64_t ns = sim_now_ns - sim_press_ns;
+        switches.count++;
+        switches.total_ns += ns;
+        if (ns > switches.max_ns) switches.max_ns = ns;
+    }
+    switches.last = p;
+    p->frames++;
+    p->bytes += bytes;
+    p->windows += windows;
+    p->transactions += transactions;
+    p->wire_ns += spi_wire_ns;
+    if (bytes > p->max_bytes) p->max_bytes = bytes;
+    if (windows > p->max_windows) p->max_windows = windows;
+    if (spi_wire_ns > p->max_wire_ns) p->max_wire_ns = spi_wire_ns;
+    spi_wire_ns = 0;
+    if (!transactions) return;  // Panel unchanged
+    p->hash = panel_hash();
+
+    if (sim_opt.ppm_dir) {
+        char path[256];
+        ppm_path(path, sizeof(path), label, "");
+        panel_write_ppm(path);
+    }
+}
+
+FILE* sim_framebuffer_report(const char* label, const uint16_t* framebuffer) {
+    uint32_t differ = 0;
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        for (int x = 0; x < PANEL_WIDTH; x++) {
+            differ += framebuffer[y * PANEL_WIDTH + x] != panel[y][x];
+        }
+    }
+    fb_check.frames++;
+    if (differ) {
+        if (!fb_check.mismatched++) snprintf(fb_check.first, sizeof(fb_check.first), "%s", label);
+        if (differ > fb_check.max_pixels) fb_check.max_pixels = differ;
+    }
+    if (!sim_opt.ppm_dir) return NULL;
+    char path[256];
+    ppm_path(path, sizeof(path), label, ".fb");
+    return fopen(path, "wb");
+}
+
+// Replay comparison of the Kalman-filtered speed against the raw NMEA speed:
+// how far the drawn value strays from the latest fix, and how big its
+// steps from one draw to the next are compared with the raw value's
+static struct {
+    uint32_t draws;
+    uint64_t diff_sum;
+    uint32_t diff_max;
+    uint32_t last_raw, last_shown;
+    uint32_t raw_step_max, shown_step_max;
+    uint32_t raw_changes, shown_changes;
+} motion;
+
+static uint32_t abs_diff(uint32_t a, uint32_t b) {
+    return a > b ? a - b : b - a;
+}
+
+void sim_motion_report(uint32_t raw_speed, uint32_t shown_speed) {
+    if (motion.draws) {
+        uint32_t raw_step = abs_diff(raw_speed, motion.last_raw);
+        uint32_t shown_step = abs_diff(shown_speed, motion.last_shown);
+        if (raw_step > motion.raw_step_max) motion.raw_step_max = raw_step;
+        if (shown_step > motion.shown_step_max) motion.shown_step_max = shown_step;
+        motion.raw_changes += raw_step != 0;
+        motion.shown_changes += shown_step != 0;
+    }
+    uint32_t diff = abs_diff(raw_speed, shown_speed);
+    motion.diff_sum += diff;
+    if (diff > motion.diff_max) motion.diff_max = diff;
+    motion.last_raw = raw_speed;
+    motion.last_shown = shown_speed;
+    motion.draws++;
+}
+
+void sim_spi_report(void) {
+    fprintf(sim_log, "\nSPI at %u Hz: per page draw (first draw includes the page chrome)\n", spi0->baud);
+    fprintf(sim_log, "%-18s %6s %12s %10s %9s %9s %13s %13s  %s\n", "page", "draws", "avg bytes", "max bytes",
+            "avg win", "max win", "avg frame ms", "max frame ms", "last panel");
+    for (int i = 0; i < page_count; i++) {
+        page_stats_t* p = &pages[i];
+        fprintf(sim_log, "%-18s %6u %12.0f %10u %9.1f %9u %13.3f %13.3f  %08x\n", p->label, p->frames,
+                (double)p->bytes / p->frames, p->max_bytes, (double)p->windows / p->frames, p->max_windows,
+                p->wire_ns / 1e6 / p->frames, p->max_wire_ns / 1e6, p->hash);
+    }
+    fprintf(sim_log, "panel: %u commands, %u unknown, %llu bytes with CS high, %s, %s\n", lcd.commands,
+            lcd.unknown, (unsigned long long)spi_stray_bytes, lcd.on ? "display on" : "display off",
+            lcd.sleeping ? "sleeping" : "awake");
+    panel_mode_account();
+    if (lcd.asleep_ns || lcd.idle_ns) {
+        fprintf(sim_log, "panel power: asleep %.1f%%, idle mode %.1f%% of the run\n", 100.0 * lcd.asleep_ns / sim_now_ns,
+                100.0 * lcd.idle_ns / sim_now_ns);
+    }
+    if (fb_check.frames) {
+        fprintf(sim_log, "framebuffer: %u flushed draws checked against panel memory, ", fb_check.frames);
+        if (fb_check.mismatched) {
+            fprintf(sim_log, "%u differed (first on %s, up to %u pixels)\n", fb_check.mismatched, fb_check.first,
+                    fb_check.max_pixels);
+        } else {
+            fprintf(sim_log, "all identical\n");
+        }
+    }
+    if (switches.count) {
+        fprintf(sim_log, "page switches: %u, press to new page drawn %.3f ms mean, %.3f max\n", switches.count,
+                switches.total_ns / 1e6 / switches.count, switches.max_ns / 1e6);
+    }
+    if (motion.draws) {
+        fprintf(sim_log, "speed: %u draws, filtered vs raw NMEA %.2f km/h mean, %.2f max; "
+                "per draw step max %.2f raw, %.2f filtered; changed on %u raw, %u filtered\n",
+                motion.draws, motion.diff_sum / 100.0 / motion.draws, motion.diff_max / 100.0,
+                motion.raw_step_max / 100.0, motion.shown_step_max / 100.0, motion.raw_changes, motion.shown_changes);
+    }
+}
@@ -0,0 +1,489 @@
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "hardware/uart.h"
+
+// uart1 and a simulated MTK3339 on the other end of it
+// The module replays an NMEA capture one fix epoch at a time and answers the
+// PMTK commands the firmware sends: baud rate, fix interval, sentence output,
+// restarts and standby. Until the first PMTK314 every sentence in the capture
+// goes out; after it only the types that command enabled, each on its own
+// every-Nth-fix interval. Bytes sent at a rate the other side is not using
+// arrive as garbage, which is what the firmware's baud detection relies on.
+
+#define UART_FIFO_SIZE 32
+#define UART_RX_LEVEL 4     // RX interrupt at 1/8 full, as the SDK sets it
+#define UART_TX_LEVEL 4     // TX interrupt at 1/8 full or less
+#define GPS_BOOT_MS 100     // First output after power up
+#define GPS_MAX_LINE 128
+#define GPS_MAX_REPLIES 8
+#define GPS_OUTPUT_TYPES 6  // PMTK314 fields modelled: GLL, RMC, VTG, GGA, GSA, GSV
+
+struct uart_inst { uint index; uart_hw_t hw; };
+static struct uart_inst uart_units[2] = { { .index = 0 }, { .index = 1 } };
+uart_inst_t* const uart0 = &uart_units[0];
+uart_inst_t* const uart1 = &uart_units[1];
+
+static struct {
+    uint baud;
+    bool rx_irq, tx_irq;
+    uint8_t rx[UART_FIFO_SIZE];
+    uint rx_head, rx_count;
+    uint64_t rx_last_ns;       // Last byte into the RX FIFO, for the RX timeout
+    uint8_t tx[UART_FIFO_SIZE];
+    uint tx_head, tx_count;
+    uint64_t tx_next_ns;       // When the byte at the head of the TX FIFO is out
+    uint32_t overruns;
+    uint32_t dropped;          // Bytes the firmware reported lost after the FIFO
+} u1;
+
+static uint64_t byte_ns(uint baud) {
+    return 10000000000ull / (baud ? baud : 9600);  // Start + 8 data + stop bits
+}
+
+// Garbage seen by a receiver at the wrong rate; never '$' or a line end
+static uint8_t garble(uint8_t b) {
+    return 0x80 | (b ^ 0x2A);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Simulated MTK3339
+
+static struct {
+    char** lines;              // Capture, one sentence per entry, "\r\n" included
+    uint32_t line_count;
+    uint32_t* epochs;          // First line of each fix epoch, plus an end marker
+    uint32_t epoch_count;
+
+    uint baud;
+    uint32_t fix_ms;
+    bool standby;
+    uint64_t standby_since_ns;
+    uint64_t standby_ns;       // Total time in standby, up to standby_since_ns
+    bool done;                 // Capture delivered and not looping
+
+    uint32_t epoch;            // Epoch being sent
+    uint32_t cursor, end;      // Next capture line of that epoch, one past its last
+    uint64_t epoch_ns;         // When the next epoch starts
+
+    char line[GPS_MAX_LINE];   // Sentence on the wire
+    size_t len, pos;
+    uint64_t next_ns;          // Next byte, or when to look for the next sentence
+
+    char replies[GPS_MAX_REPLIES][GPS_MAX_LINE];
+    uint reply_head, reply_count;
+
+    char cmd[GPS_MAX_LINE];    // Command being received
+    size_t cmd_len;
+
+    uint64_t sentences, bytes, garbled;
+    uint32_t commands, bad_commands, baud_changes;
+    uint32_t command_types[8];
+    uint32_t command_seen[8];
+
+    bool output_set;           // A PMTK314 has chosen the sentences
+    uint32_t output_every[GPS_OUTPUT_TYPES];  // Fixes between sentences of each type, 0 = off
+    uint64_t sent_by_type[GPS_OUTPUT_TYPES];
+    uint64_t held_back;        // Capture sentences the output setting left out
+} gps = { .fix_ms = 1000, .next_ns = UINT64_MAX };
+
+static void gps_reply(const char* body) {
+    if (gps.reply_count == GPS_MAX_REPLIES) return;
+    uint8_t sum = 0;
+    for (const char* c = body; *c; c++) sum ^= (uint8_t)*c;
+    char* r = gps.replies[(gps.reply_head + gps.reply_count++) % GPS_MAX_REPLIES];
+    snprintf(r, GPS_MAX_LINE, "$%s*%02X\r\n", body, sum);
+    if (gps.next_ns == UINT64_MAX || (gps.pos >= gps.len && gps.next_ns > sim_now_ns)) {
+        gps.next_ns = sim_now_ns;  // Idle: answer right away
+    }
+}
+
+static void gps_ack(int type, int flag) {
+    char body[32];
+    snprintf(body, sizeof(body), "PMTK001,%d,%d", type, flag);
+    gps_reply(body);
+}
+
+static void gps_count_command(int type) {
+    for (int i = 0; i < 8; i++) {
+        if (gps.command_seen[i] && gps.command_types[i] == (uint32_t)type) {
+            gps.command_seen[i]++;
+            return;
+        }
+        if (!gps.command_seen[i]) {
+            gps.command_types[i] = type;
+            gps.command_seen[i] = 1;
+            return;
+        }
+    }
+}
+
+// Sentence types in PMTK314 field order
+static const char* const gps_output_names[GPS_OUTPUT_TYPES] = { "GLL", "RMC", "VTG", "GGA", "GSA", "GSV" };
+
+// PMTK314 field of a capture line ("$GPGSV,..." -> 5), or -1 for other types
+static int gps_output_type(const char* line) {
+    for (int i = 0; i < GPS_OUTPUT_TYPES; i++) {
+        if (strncmp(line + 3, gps_output_names[i], 3) == 0) return i;
+    }
+    return -1;
+}
+
+// PMTK314,f0,f1,...: each field is 0 (off) or send every Nth fix; -1 is the
+// factory setting, modelled as the capture unchanged
+static void gps_set_output(const char* args) {
+    if (!args || atoi(args + 1) < 0) {
+        gps.output_set = false;
+        return;
+    }
+    gps.output_set = true;
+    for (int i = 0; i < GPS_OUTPUT_TYPES; i++) {
+        gps.output_every[i] = args ? (uint32_t)atoi(args + 1) : 0;
+        if (args) args = strchr(args + 1, ',');
+    }
+}
+
+// Whether the module sends this capture line in the current epoch
+static bool gps_output_enabled(const char* line) {
+    if (!gps.output_set) return true;
+    int type = gps_output_type(line);
+    if (type < 0 || !gps.output_every[type]) return false;
+    return gps.epoch % gps.output_every[type] == 0;
+}
+
+// Act on one complete line from the firmware
+static void gps_set_standby(bool standby) {
+    if (gps.standby) gps.standby_ns += sim_now_ns - gps.standby_since_ns;
+    gps.standby = standby;
+    gps.standby_since_ns = sim_now_ns;
+}
+
+static void gps_command(const char* line) {
+    const char* star = strchr(line, '*');
+    if (line[0] != '$' || !star || strncmp(line + 1, "PMTK", 4) != 0) {
+        gps.bad_commands++;
+        return;
+    }
+    uint8_t sum = 0;
+    for (const char* c = line + 1; c < star; c++) sum ^= (uint8_t)*c;
+    if (strtoul(star + 1, NULL, 16) != sum) {
+        gps.bad_commands++;  // The module drops these without an answer
+        return;
+    }
+    int type = atoi(line + 5);
+    const char* args = strchr(line, ',');
+    gps.commands++;
+    gps_count_command(type);
+
+    switch (type) {
+        case 251: {  // Baud rate; takes effect immediately, no ACK
+            uint baud = args ? (uint)atoi(args + 1) : 0;
+            gps.baud = baud ? baud : 9600;
+            gps.baud_changes++;
+            break;
+        }
+        case 220:  // Fix interval
+            if (args && atoi(args + 1) >= 100) gps.fix_ms = atoi(args + 1);
+            gps_ack(type, 3);
+            break;
+        case 101: case 102: case 103: case 104:  // Restarts answer with a boot message
+            gps_set_standby(false);
+            gps_reply("PMTK010,001");
+            break;
+        case 161:  // Standby until the next byte received
+            gps_ack(type, 3);
+            gps_set_standby(true);
+            break;
+        case 314:  // Sentence output
+            gps_set_output(args);
+            gps_ack(type, 3);
+            break;
+        case 0: case 225: case 300: case 386: case 397:
+            gps_ack(type, 3);
+            break;
+        default:
+            gps_ack(type, 1);  // Unsupported
+            break;
+    }
+}
+
+// A byte from the firmware reaches the module
+static void gps_receive(uint8_t b) {
+    if (gps.standby) {
+        gps_set_standby(false);  // Any byte wakes it; skip the epochs it slept through
+        while (gps.epoch_ns < sim_now_ns) {
+            gps.epoch_ns += gps.fix_ms * 1000000ull;
+            gps.epoch++;
+        }
+        if (gps.next_ns == UINT64_MAX) gps.next_ns = sim_now_ns;
+    }
+    if (b == '\n') {
+        gps.cmd[gps.cmd_len] = '\0';
+        if (gps.cmd_len && gps.cmd[gps.cmd_len - 1] == '\r') gps.cmd[gps.cmd_len - 1] = '\0';
+        gps_command(gps.cmd);
+        gps.cmd_len = 0;
+    } else if (gps.cmd_len < GPS_MAX_LINE - 1) {
+        gps.cmd[gps.cmd_len++] = (char)b;
+    }
+}
+
+// A byte from the module reaches the RX FIFO
+static void uart_rx_push(uint8_t b) {
+    if (u1.baud != gps.baud) {
+        b = garble(b);
+        gps.garbled++;
+    }
+    if (u1.rx_count == 0 && sim_dma_rx(uart_get_dreq_num(uart1, false), b)) return;  // The DREQ drains the FIFO
+    if (u1.rx_count == UART_FIFO_SIZE) {
+        u1.overruns++;
+        return;
+    }
+    u1.rx[(u1.rx_head + u1.rx_count++) % UART_FIFO_SIZE] = b;
+    u1.rx_last_ns = sim_now_ns;
+}
+
+static void gps_start_line(const char* text) {
+    snprintf(gps.line, sizeof(gps.line), "%s", text);
+    gps.len = strlen(gps.line);
+    gps.pos = 0;
+    gps.next_ns = sim_now_ns + byte_ns(gps.baud);
+}
+
+// Start the next line of the epoch the output setting lets through
+// Returns false when the epoch has nothing more to send
+static bool gps_next_sentence(void) {
+    while (gps.cursor < gps.end && !gps_output_enabled(gps.lines[gps.cursor])) {
+        gps.cursor++;
+        gps.held_back++;
+    }
+    if (gps.cursor == gps.end) return false;
+    int type = gps_output_type(gps.lines[gps.cursor]);
+    if (type >= 0) gps.sent_by_type[type]++;
+    gps.sentences++;
+    gps_start_line(gps.lines[gps.cursor++]);
+    return true;
+}
+
+// Pick what goes out next: answers first, then the rest of the epoch
+static void gps_next_line(void) {
+    if (gps.reply_count) {
+        gps_start_line(gps.replies[gps.reply_head]);
+        gps.reply_head = (gps.reply_head + 1) % GPS_MAX_REPLIES;
+        gps.reply_count--;
+        return;
+    }
+    if (gps.standby || gps.done || !gps.epoch_count) {
+        gps.next_ns = UINT64_MAX;
+        return;
+    }
+    if (gps_next_sentence()) return;
+    if (sim_now_ns < gps.epoch_ns) {
+        gps.next_ns = gps.epoch_ns;
+        return;
+    }
+
+    // Next epoch; one that is late because the link is too slow starts now
+    if (gps.epoch >= gps.epoch_count) {
+        if (!sim_opt.nmea_loop) {
+            gps.done = true;
+            gps.next_ns = UINT64_MAX;
+            return;
+        }
+        gps.epoch %= gps.epoch_count;
+    }
+    gps.cursor = gps.epochs[gps.epoch];
+    gps.end = gps.epochs[gps.epoch + 1];
+    gps.epoch++;
+    gps.epoch_ns += gps.fix_ms * 1000000ull;
+    if (gps.epoch_ns < sim_now_ns) gps.epoch_ns = sim_now_ns;
+    if (!gps_next_sentence()) gps.next_ns = gps.epoch_ns;
+}
+
+static void gps_step(void) {
+    if (gps.pos < gps.len) {
+        uart_rx_push((uint8_t)gps.line[gps.pos++]);
+        gps.bytes++;
+        gps.next_ns += byte_ns(gps.baud);
+        if (gps.pos < gps.len) return;
+    }
+    gps_next_line();
+}
+
+// Read the capture and split it into epochs
+// An epoch starts at every sentence with the same type as the capture's first
+void sim_uart_load(void) {
+    gps.baud = sim_opt.gps_baud ? sim_opt.gps_baud : 9600;
+    gps.epoch_ns = GPS_BOOT_MS * 1000000ull;
+    gps.next_ns = gps.epoch_ns;
+    if (!sim_opt.nmea_path) return;
+
+    FILE* f = fopen(sim_opt.nmea_path, "r");
+    if (!f) {
+        fprintf(sim_log, "sim: cannot open %s\n", sim_opt.nmea_path);
+        exit(1);
+    }
+    uint32_t cap = 0;
+    char buf[GPS_MAX_LINE];
+    char first[4] = "";
+    while (fgets(buf, sizeof(buf), f)) {
+        size_t n = strcspn(buf, "\r\n");
+        buf[n] = '\0';
+        if (buf[0] != '$' || n < 7) continue;
+        if (gps.line_count == cap) {
+            cap = cap ? cap * 2 : 256;
+            gps.lines = realloc(gps.lines, cap * sizeof(char*));
+            gps.epochs = realloc(gps.epochs, (cap + 1) * sizeof(uint32_t));
+        }
+        if (!first[0]) memcpy(first, buf + 3, 3);
+        if (memcmp(buf + 3, first, 3) == 0) gps.epochs[gps.epoch_count++] = gps.line_count;
+        gps.lines[gps.line_count] = malloc(n + 3);
+        snprintf(gps.lines[gps.line_count], n + 3, "%s\r\n", buf);
+        gps.line_count++;
+    }
+    fclose(f);
+    if (!gps.line_count) {
+        fprintf(sim_log, "sim: no NMEA sentences in %s\n", sim_opt.nmea_path);
+        exit(1);
+    }
+    gps.epochs[gps.epoch_count] = gps.line_count;
+}
+
+bool sim_uart_done(void) {
+    return gps.done && gps.pos >= gps.len && u1.rx_count == 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// uart1
+
+uint uart_set_baudrate(uart_inst_t* uart, uint baudrate) {
+    if (uart == uart1) u1.baud = baudrate;
+    return baudrate;
+}
+
+uint uart_init(uart_inst_t* uart, uint baudrate) {
+    if (uart == uart1) {
+        u1.rx_count = u1.tx_count = 0;
+        u1.rx_irq = u1.tx_irq = false;
+    }
+    return uart_set_baudrate(uart, baudrate);
+}
+
+void uart_set_format(uart_inst_t* uart, uint data_bits, uint stop_bits, uart_parity_t parity) {
+    (void)uart;
+    (void)data_bits;
+    (void)stop_bits;
+    (void)parity;
+}
+
+void uart_set_fifo_enabled(uart_inst_t* uart, bool enabled) {
+    (void)uart;
+    (void)enabled;
+}
+
+void uart_set_irq_enables(uart_inst_t* uart, bool rx_has_data, bool tx_needs_data) {
+    if (uart != uart1) return;
+    u1.rx_irq = rx_has_data;
+    u1.tx_irq = tx_needs_data;
+    sim_dispatch();
+}
+
+bool uart_is_readable(uart_inst_t* uart) {
+    return uart == uart1 && u1.rx_count > 0;
+}
+
+bool uart_is_writable(uart_inst_t* uart) {
+    return uart != uart1 || u1.tx_count < UART_FIFO_SIZE;
+}
+
+char uart_getc(uart_inst_t* uart) {
+    if (uart != uart1) return 0;
+    while (!u1.rx_count) sim_wait_until(UINT64_MAX);
+    uint8_t b = u1.rx[u1.rx_head];
+    u1.rx_head = (u1.rx_head + 1) % UART_FIFO_SIZE;
+    u1.rx_count--;
+    return (char)b;
+}
+
+void uart_putc_raw(uart_inst_t* uart, char c) {
+    if (uart != uart1) return;
+    while (u1.tx_count == UART_FIFO_SIZE) sim_wait_until(u1.tx_next_ns);
+    if (u1.tx_count == 0) u1.tx_next_ns = sim_now_ns + byte_ns(u1.baud);
+    u1.tx[(u1.tx_head + u1.tx_count++) % UART_FIFO_SIZE] = (uint8_t)c;
+}
+
+void uart_write_blocking(uart_inst_t* uart, const uint8_t* src, size_t len) {
+    for (size_t i = 0; i < len; i++) uart_putc_raw(uart, (char)src[i]);
+}
+
+uart_hw_t* uart_get_hw(uart_inst_t* uart) {
+    return &uart->hw;
+}
+
+uint uart_get_dreq_num(uart_inst_t* uart, bool is_tx) {
+    return 4 + uart->index * 2 + !is_tx;
+}
+
+uint32_t sim_uart_overruns(void) {
+    return u1.overruns;
+}
+
+void sim_gps_dropped(uint32_t bytes) {
+    u1.dropped += bytes;
+}
+
+void uart_tx_wait_blocking(uart_inst_t* uart) {
+    if (uart != uart1) return;
+    while (u1.tx_count) sim_wait_until(u1.tx_next_ns);
+}
+
+static uint64_t rx_timeout_ns(void) {
+    return u1.rx_last_ns + 32 * byte_ns(u1.baud) / 10;  // 32 bit periods
+}
+
+uint64_t sim_uart_next(void) {
+    uint64_t next = gps.next_ns;
+    if (u1.tx_count && u1.tx_next_ns < next) next = u1.tx_next_ns;
+    if (u1.rx_irq && u1.rx_count && u1.rx_count < UART_RX_LEVEL) {
+        uint64_t t = rx_timeout_ns();
+        if (t > sim_now_ns && t < next) next = t;
+    }
+    return next;
+}
+
+void sim_uart_fire(void) {
+    uint64_t now = sim_now_ns;
+    if (u1.tx_count && u1.tx_next_ns <= now) {
+        uint8_t b = u1.tx[u1.tx_head];
+        u1.tx_head = (u1.tx_head + 1) % UART_FIFO_SIZE;
+        u1.tx_count--;
+        gps_receive(u1.baud == gps.baud ? b : garble(b));
+        if (u1.tx_count) u1.tx_next_ns += byte_ns(u1.baud);
+    }
+    if (gps.next_ns <= now) gps_step();
+}
+
+bool sim_uart_line(void) {
+    bool rx = u1.rx_irq && (u1.rx_count >= UART_RX_LEVEL || (u1.rx_count && sim_now_ns >= rx_timeout_ns()));
+    bool tx = u1.tx_irq && u1.tx_count <= UART_TX_LEVEL;
+    return rx || tx;
+}
+
+void sim_uart_report(void) {
+    fprintf(sim_log, "\nGPS link: %llu sentences, %llu bytes (%llu garbled), %u RX overruns, %u bytes dropped by the "
+            "firmware, module at %u baud, uart1 at %u baud\n", (unsigned long long)gps.sentences,
+            (unsigned long long)gps.bytes, (unsigned long long)gps.garbled, u1.overruns, u1.dropped, gps.baud, u1.baud);
+    fprintf(sim_log, "PMTK: %u commands (%u unreadable), %u baud changes, fix every %u ms, %s\n", gps.commands,
+            gps.bad_commands, gps.baud_changes, gps.fix_ms, gps.standby ? "in standby" : "running");
+    fprintf(sim_log, "sent by type:");
+    for (int i = 0; i < GPS_OUTPUT_TYPES; i++) {
+        fprintf(sim_log, " %s %llu", gps_output_names[i], (unsigned long long)gps.sent_by_type[i]);
+    }
+    fprintf(sim_log, "; %llu capture sentences left out by PMTK314\n", (unsigned long long)gps.held_back);
+    gps_set_standby(gps.standby);
+    if (gps.standby_ns) fprintf(sim_log, "GPS in standby %.1f%% of the run\n", 100.0 * gps.standby_ns / sim_now_ns);
+    for (int i = 0; i < 8 && gps.command_seen[i]; i++) {
+        fprintf(sim_log, "  PMTK%03u x%u\n", gps.command_types[i], gps.command_seen[i]);
+    }
+}
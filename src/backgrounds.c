@@ -0,0 +1,1835 @@
+// Generated by tools/gen_backgrounds.c from the display_*_chrome functions
+// in src/lcd.h. Do not edit; rebuild to regenerate.
+#include "background.h"
+
+// bg_speed: 2012 words for 76800 pixels
+static const uint16_t bg_speed_data[2012] = {
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F,
+    0x000A, 0xFFFF, 0x0044, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000C, 0x001F, 0x000A, 0xFFFF, 0x0044, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002,
+    0xFFFF, 0xFFFF, 0x0042, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075,
+    0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x0042, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF,
+    0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F,
+    0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007,
+    0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F,
+    0x000A, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F,
+    0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F, 0x000A, 0xFFFF,
+    0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F,
+    0x000A, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x0016, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x000E, 0xFFFF, 0x0003, 0x001F, 0x000E, 0xFFFF, 0x0003,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A,
+    0xFFFF, 0x000A, 0xFFFF, 0x0016, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x000E, 0xFFFF, 0x0003, 0x001F,
+    0x000E, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x000C, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0003, 0x001F, 0x000C, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x8002,
+    0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F,
+    0x000A, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0x001F, 0x000A, 0xFFFF, 0x0007,
+    0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075,
+    0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F, 0x000A, 0xFFFF, 0x0005, 0x001F, 0x8002,
+    0xFFFF, 0xFFFF, 0x0011, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F,
+    0x000C, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x001B, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x00BF, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x001B,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x00BF, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x002C, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF, 0x00A0, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x002C, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x001B, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x002A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x002A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF,
+    0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF,
+    0x0006, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0007, 0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0011, 0xFFFF, 0x00A0,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x0006,
+    0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007,
+    0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0011, 0xFFFF, 0x00A0, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x0004,
+    0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x0008, 0x0000,
+    0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000B, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x0008, 0x0000,
+    0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000B, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0016, 0xFFFF, 0x000A, 0x0000, 0x008F, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x000E, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x0019,
+    0xFFFF, 0x0016, 0xFFFF, 0x000A, 0x0000, 0x008F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF,
+    0x000E, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x0019, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x008B, 0xFFFF, 0x0004, 0x0000, 0x0009, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0017, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x008B, 0xFFFF, 0x0004, 0x0000, 0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0017, 0xFFFF, 0x0014, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
+    0x008D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
+    0x0017, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8006, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x008D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8006, 0x0000, 0x0000,
+    0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0017, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x008D, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0009, 0xFFFF, 0x000C, 0x0000, 0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0017, 0xFFFF, 0x0014,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x008D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x000C, 0x0000, 0x0005,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0017, 0xFFFF, 0x0014, 0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x008D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0015,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0017, 0xFFFF, 0x0014, 0xFFFF, 0x8006, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x008D, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0015, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8006, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0017, 0xFFFF,
+    0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x008D, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0017,
+    0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x008D,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0017, 0xFFFF, 0x0016, 0xFFFF, 0x000A, 0x0000, 0x008D, 0xFFFF, 0x0006, 0x0000, 0x0009, 0xFFFF,
+    0x000A, 0x0000, 0x0007, 0xFFFF, 0x000A, 0x0000, 0x0019, 0xFFFF, 0x0016, 0xFFFF, 0x000A, 0x0000,
+    0x008D, 0xFFFF, 0x0006, 0x0000, 0x0009, 0xFFFF, 0x000A, 0x0000, 0x0007, 0xFFFF, 0x000A, 0x0000,
+    0x0019, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+};
+
+static const uint16_t bg_speed_rows[320] = {
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0012, 0x0014, 0x001A,
+    0x0020, 0x0026, 0x002C, 0x0032, 0x0038, 0x003E, 0x0044, 0x0053, 0x0062, 0x007B, 0x0094, 0x00B3,
+    0x00D2, 0x0104, 0x0136, 0x015D, 0x0184, 0x01B0, 0x01DC, 0x01FB, 0x021A, 0x0225, 0x0230, 0x0236,
+    0x023C, 0x0242, 0x0248, 0x024E, 0x0254, 0x0256, 0x0258, 0x025A, 0x025C, 0x025E, 0x0260, 0x0262,
+    0x0264, 0x0266, 0x0268, 0x0279, 0x028A, 0x029B, 0x02AC, 0x02CF, 0x02F2, 0x031B, 0x0344, 0x0368,
+    0x038C, 0x03B6, 0x03E0, 0x040A, 0x0434, 0x0436, 0x0438, 0x043A, 0x043C, 0x043E, 0x0440, 0x0442,
+    0x0444, 0x0446, 0x0448, 0x044A, 0x044C, 0x044E, 0x0450, 0x0452, 0x0454, 0x0456, 0x0458, 0x045A,
+    0x045C, 0x045E, 0x0460, 0x0462, 0x0464, 0x0466, 0x0468, 0x046A, 0x046C, 0x046E, 0x0470, 0x0472,
+    0x0474, 0x0476, 0x0478, 0x047A, 0x047C, 0x047E, 0x0480, 0x0482, 0x0484, 0x0486, 0x0488, 0x048A,
+    0x048C, 0x048E, 0x0490, 0x0492, 0x0494, 0x0496, 0x0498, 0x049A, 0x049C, 0x049E, 0x04A0, 0x04A2,
+    0x04A4, 0x04A6, 0x04A8, 0x04AA, 0x04AC, 0x04AE, 0x04B0, 0x04B2, 0x04B4, 0x04B6, 0x04B8, 0x04BA,
+    0x04BC, 0x04BE, 0x04C0, 0x04C2, 0x04C4, 0x04C6, 0x04C8, 0x04CA, 0x04CC, 0x04CE, 0x04D0, 0x04D2,
+    0x04D4, 0x04D6, 0x04D8, 0x04DA, 0x04DC, 0x04DE, 0x04E0, 0x04E2, 0x04E4, 0x04E6, 0x04E8, 0x04EA,
+    0x04EC, 0x04EE, 0x04F0, 0x04F2, 0x04F4, 0x04F6, 0x04F8, 0x04FA, 0x04FC, 0x04FE, 0x0511, 0x0524,
+    0x0543, 0x0562, 0x058A, 0x05B2, 0x05DB, 0x0604, 0x062C, 0x0654, 0x0679, 0x069E, 0x06B0, 0x06C2,
+    0x06C4, 0x06C6, 0x06C8, 0x06CA, 0x06CC, 0x06CE, 0x06D0, 0x06D2, 0x06D4, 0x06D6, 0x06D8, 0x06DA,
+    0x06DC, 0x06DE, 0x06E0, 0x06E2, 0x06E4, 0x06E6, 0x06E8, 0x06EA, 0x06EC, 0x06EE, 0x06F0, 0x06F2,
+    0x06F4, 0x06F6, 0x06F8, 0x06FA, 0x06FC, 0x06FE, 0x0700, 0x0702, 0x0704, 0x0706, 0x0708, 0x070A,
+    0x070C, 0x070E, 0x0710, 0x0712, 0x0714, 0x0716, 0x0718, 0x071A, 0x071C, 0x071E, 0x0720, 0x0722,
+    0x0724, 0x0726, 0x0728, 0x072A, 0x072C, 0x072E, 0x0730, 0x0732, 0x0734, 0x0736, 0x0738, 0x073A,
+    0x073C, 0x073E, 0x0740, 0x0742, 0x0744, 0x0746, 0x0748, 0x074A, 0x074C, 0x074E, 0x0750, 0x0752,
+    0x0754, 0x0756, 0x0758, 0x075A, 0x075C, 0x075E, 0x0760, 0x0762, 0x0764, 0x0766, 0x0768, 0x076A,
+    0x076C, 0x076E, 0x0770, 0x0772, 0x0774, 0x0776, 0x0778, 0x077A, 0x077C, 0x077E, 0x0780, 0x0782,
+    0x0784, 0x0786, 0x0788, 0x078A, 0x078C, 0x078E, 0x0790, 0x0792, 0x0794, 0x0796, 0x0798, 0x079A,
+    0x079C, 0x079E, 0x07A0, 0x07A2, 0x07A4, 0x07A6, 0x07A8, 0x07AA, 0x07AC, 0x07AE, 0x07B0, 0x07B2,
+    0x07B4, 0x07B6, 0x07B8, 0x07BA, 0x07BC, 0x07BE, 0x07C0, 0x07C2, 0x07C4, 0x07C6, 0x07C8, 0x07CA,
+    0x07CC, 0x07CE, 0x07D0, 0x07D2, 0x07D4, 0x07D6, 0x07D8, 0x07DA,
+};
+
+const bg_image_t bg_speed = { 240, 320, bg_speed_rows, bg_speed_data };
+
+// bg_location: 2980 words for 76800 pixels
+static const uint16_t bg_location_data[2980] = {
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x0046, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0077, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x0046, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0077, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0046, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x0042, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0046, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0042, 0xF800,
+    0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0011, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A,
+    0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0xF800,
+    0x000A, 0xFFFF, 0x0005, 0xF800, 0x8004, 0xFFFF, 0xFFFF, 0xF800, 0xF800, 0x0008, 0xFFFF, 0x0009,
+    0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x0011, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800,
+    0x000A, 0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000D,
+    0xF800, 0x000A, 0xFFFF, 0x0005, 0xF800, 0x8004, 0xFFFF, 0xFFFF, 0xF800, 0xF800, 0x0008, 0xFFFF,
+    0x0009, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x0003, 0xF800, 0x0004, 0xFFFF, 0x0008, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A,
+    0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x0004, 0xFFFF, 0x0008, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0xF800, 0x000C, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0xF800, 0x000C, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x0006, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x000A, 0xF800, 0x000E, 0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A, 0xFFFF,
+    0x0007, 0xF800, 0x000C, 0xFFFF, 0x0009, 0xF800, 0x0006, 0xFFFF, 0x0009, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000D, 0xF800, 0x000A, 0xFFFF, 0x0005, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000A, 0xF800, 0x000E, 0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A,
+    0xFFFF, 0x0007, 0xF800, 0x000C, 0xFFFF, 0x0009, 0xF800, 0x0006, 0xFFFF, 0x0009, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000D, 0xF800, 0x000A, 0xFFFF, 0x0005, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF,
+    0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF,
+    0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A,
+    0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x000B, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000,
+    0x000B, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000C,
+    0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0011, 0xFFFF, 0x000C, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF,
+    0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000, 0x0005, 0xFFFF, 0x000C, 0x0000, 0x0009, 0xFFFF,
+    0x0006, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000,
+    0x0005, 0xFFFF, 0x000C, 0x0000, 0x0009, 0xFFFF, 0x0006, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00DA, 0xFFFF, 0x0014, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x00DA, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0035, 0xFFFF, 0x0004,
+    0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0035, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A, 0x0000, 0x0005,
+    0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A, 0x0000, 0x0005,
+    0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x0004, 0x0000, 0x0008, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x0004, 0x0000, 0x0008,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00AC, 0xFFFF,
+    0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x0005, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x0005, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x0078, 0xFFFF, 0x8001, 0x9240, 0x0077, 0xFFFF, 0x006C, 0xFFFF, 0x0019, 0x9240,
+    0x006B, 0xFFFF, 0x0067, 0xFFFF, 0x0023, 0x9240, 0x0066, 0xFFFF, 0x0063, 0xFFFF, 0x002B, 0x9240,
+    0x0062, 0xFFFF, 0x0060, 0xFFFF, 0x0031, 0x9240, 0x005F, 0xFFFF, 0x005D, 0xFFFF, 0x0037, 0x9240,
+    0x005C, 0xFFFF, 0x005A, 0xFFFF, 0x003D, 0x9240, 0x0059, 0xFFFF, 0x0058, 0xFFFF, 0x0041, 0x9240,
+    0x0057, 0xFFFF, 0x0056, 0xFFFF, 0x0045, 0x9240, 0x0055, 0xFFFF, 0x0054, 0xFFFF, 0x0049, 0x9240,
+    0x0053, 0xFFFF, 0x0052, 0xFFFF, 0x0021, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002,
+    0x0000, 0x0000, 0x001E, 0x9240, 0x0051, 0xFFFF, 0x0050, 0xFFFF, 0x0023, 0x9240, 0x8002, 0x0000,
+    0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000, 0x0020, 0x9240, 0x004F, 0xFFFF, 0x004E, 0xFFFF,
+    0x0025, 0x9240, 0x0004, 0x0000, 0x0008, 0x9240, 0x8002, 0x0000, 0x0000, 0x0022, 0x9240, 0x004D,
+    0xFFFF, 0x004D, 0xFFFF, 0x0026, 0x9240, 0x0004, 0x0000, 0x0008, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x0023, 0x9240, 0x004C, 0xFFFF, 0x004B, 0xFFFF, 0x0028, 0x9240, 0x8006, 0x0000, 0x0000, 0x9240,
+    0x9240, 0x0000, 0x0000, 0x0006, 0x9240, 0x8002, 0x0000, 0x0000, 0x0025, 0x9240, 0x004A, 0xFFFF,
+    0x004A, 0xFFFF, 0x0029, 0x9240, 0x8006, 0x0000, 0x0000, 0x9240, 0x9240, 0x0000, 0x0000, 0x0006,
+    0x9240, 0x8002, 0x0000, 0x0000, 0x0026, 0x9240, 0x0049, 0xFFFF, 0x0048, 0xFFFF, 0x002B, 0x9240,
+    0x8002, 0x0000, 0x0000, 0x0004, 0x9240, 0x8002, 0x0000, 0x0000, 0x0004, 0x9240, 0x8002, 0x0000,
+    0x0000, 0x0028, 0x9240, 0x0047, 0xFFFF, 0x0047, 0xFFFF, 0x002C, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x0004, 0x9240, 0x8002, 0x0000, 0x0000, 0x0004, 0x9240, 0x8002, 0x0000, 0x0000, 0x0029, 0x9240,
+    0x0046, 0xFFFF, 0x0046, 0xFFFF, 0x002D, 0x9240, 0x8002, 0x0000, 0x0000, 0x0006, 0x9240, 0x8006,
+    0x0000, 0x0000, 0x9240, 0x9240, 0x0000, 0x0000, 0x002A, 0x9240, 0x0045, 0xFFFF, 0x0045, 0xFFFF,
+    0x002E, 0x9240, 0x8002, 0x0000, 0x0000, 0x0006, 0x9240, 0x8006, 0x0000, 0x0000, 0x9240, 0x9240,
+    0x0000, 0x0000, 0x002B, 0x9240, 0x0044, 0xFFFF, 0x0044, 0xFFFF, 0x002F, 0x9240, 0x8002, 0x0000,
+    0x0000, 0x0008, 0x9240, 0x0004, 0x0000, 0x002C, 0x9240, 0x0043, 0xFFFF, 0x0042, 0xFFFF, 0x0031,
+    0x9240, 0x8002, 0x0000, 0x0000, 0x0008, 0x9240, 0x0004, 0x0000, 0x002E, 0x9240, 0x0041, 0xFFFF,
+    0x0041, 0xFFFF, 0x0032, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x002F, 0x9240, 0x0040, 0xFFFF, 0x0040, 0xFFFF, 0x0033, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A,
+    0x9240, 0x8002, 0x0000, 0x0000, 0x0030, 0x9240, 0x003F, 0xFFFF, 0x003F, 0xFFFF, 0x0073, 0x9240,
+    0x003E, 0xFFFF, 0x003E, 0xFFFF, 0x0075, 0x9240, 0x003D, 0xFFFF, 0x003D, 0xFFFF, 0x0077, 0x9240,
+    0x003C, 0xFFFF, 0x003D, 0xFFFF, 0x0077, 0x9240, 0x003C, 0xFFFF, 0x003C, 0xFFFF, 0x0079, 0x9240,
+    0x003B, 0xFFFF, 0x003B, 0xFFFF, 0x007B, 0x9240, 0x003A, 0xFFFF, 0x003A, 0xFFFF, 0x007D, 0x9240,
+    0x0039, 0xFFFF, 0x0039, 0xFFFF, 0x007F, 0x9240, 0x0038, 0xFFFF, 0x0038, 0xFFFF, 0x0081, 0x9240,
+    0x0037, 0xFFFF, 0x0038, 0xFFFF, 0x0081, 0x9240, 0x0037, 0xFFFF, 0x0037, 0xFFFF, 0x0083, 0x9240,
+    0x0036, 0xFFFF, 0x0036, 0xFFFF, 0x0085, 0x9240, 0x0035, 0xFFFF, 0x0036, 0xFFFF, 0x0085, 0x9240,
+    0x0035, 0xFFFF, 0x0035, 0xFFFF, 0x0087, 0x9240, 0x0034, 0xFFFF, 0x0034, 0xFFFF, 0x0089, 0x9240,
+    0x0033, 0xFFFF, 0x0034, 0xFFFF, 0x0089, 0x9240, 0x0033, 0xFFFF, 0x0033, 0xFFFF, 0x008B, 0x9240,
+    0x0032, 0xFFFF, 0x0033, 0xFFFF, 0x008B, 0x9240, 0x0032, 0xFFFF, 0x0032, 0xFFFF, 0x008D, 0x9240,
+    0x0031, 0xFFFF, 0x0032, 0xFFFF, 0x008D, 0x9240, 0x0031, 0xFFFF, 0x0031, 0xFFFF, 0x008F, 0x9240,
+    0x0030, 0xFFFF, 0x0031, 0xFFFF, 0x008F, 0x9240, 0x0030, 0xFFFF, 0x0030, 0xFFFF, 0x0091, 0x9240,
+    0x002F, 0xFFFF, 0x0030, 0xFFFF, 0x0091, 0x9240, 0x002F, 0xFFFF, 0x002F, 0xFFFF, 0x0093, 0x9240,
+    0x002E, 0xFFFF, 0x002F, 0xFFFF, 0x0093, 0x9240, 0x002E, 0xFFFF, 0x002E, 0xFFFF, 0x0095, 0x9240,
+    0x002D, 0xFFFF, 0x002E, 0xFFFF, 0x0095, 0x9240, 0x002D, 0xFFFF, 0x002E, 0xFFFF, 0x0095, 0x9240,
+    0x002D, 0xFFFF, 0x002D, 0xFFFF, 0x0097, 0x9240, 0x002C, 0xFFFF, 0x002D, 0xFFFF, 0x0097, 0x9240,
+    0x002C, 0xFFFF, 0x002D, 0xFFFF, 0x0097, 0x9240, 0x002C, 0xFFFF, 0x002C, 0xFFFF, 0x0099, 0x9240,
+    0x002B, 0xFFFF, 0x002C, 0xFFFF, 0x0099, 0x9240, 0x002B, 0xFFFF, 0x002C, 0xFFFF, 0x0099, 0x9240,
+    0x002B, 0xFFFF, 0x002B, 0xFFFF, 0x009B, 0x9240, 0x002A, 0xFFFF, 0x002B, 0xFFFF, 0x009B, 0x9240,
+    0x002A, 0xFFFF, 0x002B, 0xFFFF, 0x009B, 0x9240, 0x002A, 0xFFFF, 0x002B, 0xFFFF, 0x009B, 0x9240,
+    0x002A, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x9240, 0x0029, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x9240,
+    0x0029, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x9240, 0x0029, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x9240,
+    0x0029, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x9240, 0x0029, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240,
+    0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240,
+    0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240,
+    0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240,
+    0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002,
+    0x0000, 0x0000, 0x006F, 0x9240, 0x000E, 0x0000, 0x000B, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF,
+    0x0009, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000, 0x006F, 0x9240,
+    0x000E, 0x0000, 0x000B, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002, 0x0000,
+    0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000, 0x006F, 0x9240, 0x8002, 0x0000, 0x0000, 0x0017,
+    0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240,
+    0x8002, 0x0000, 0x0000, 0x006F, 0x9240, 0x8002, 0x0000, 0x0000, 0x0017, 0x9240, 0x0028, 0xFFFF,
+    0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x006F, 0x9240, 0x8002, 0x0000, 0x0000, 0x0017, 0x9240, 0x0028, 0xFFFF, 0x0028, 0xFFFF, 0x000A,
+    0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000, 0x006F, 0x9240, 0x8002,
+    0x0000, 0x0000, 0x0018, 0x9240, 0x0027, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002, 0x0000,
+    0x0000, 0x0004, 0x9240, 0x8002, 0x0000, 0x0000, 0x0004, 0x9240, 0x8002, 0x0000, 0x0000, 0x006F,
+    0x9240, 0x000C, 0x0000, 0x000D, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002,
+    0x0000, 0x0000, 0x0004, 0x9240, 0x8002, 0x0000, 0x0000, 0x0004, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x006F, 0x9240, 0x000C, 0x0000, 0x000D, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240,
+    0x800E, 0x0000, 0x0000, 0x9240, 0x9240, 0x0000, 0x0000, 0x9240, 0x9240, 0x0000, 0x0000, 0x9240,
+    0x9240, 0x0000, 0x0000, 0x006F, 0x9240, 0x8002, 0x0000, 0x0000, 0x0017, 0x9240, 0x0028, 0xFFFF,
+    0x0029, 0xFFFF, 0x0009, 0x9240, 0x800E, 0x0000, 0x0000, 0x9240, 0x9240, 0x0000, 0x0000, 0x9240,
+    0x9240, 0x0000, 0x0000, 0x9240, 0x9240, 0x0000, 0x0000, 0x006F, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x0017, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x0004, 0x0000, 0x0006, 0x9240,
+    0x0004, 0x0000, 0x006F, 0x9240, 0x8002, 0x0000, 0x0000, 0x0017, 0x9240, 0x0028, 0xFFFF, 0x0029,
+    0xFFFF, 0x0009, 0x9240, 0x0004, 0x0000, 0x0006, 0x9240, 0x0004, 0x0000, 0x006F, 0x9240, 0x8002,
+    0x0000, 0x0000, 0x0017, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002, 0x0000,
+    0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000, 0x006F, 0x9240, 0x000E, 0x0000, 0x000B, 0x9240,
+    0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x0009, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002,
+    0x0000, 0x0000, 0x006F, 0x9240, 0x000E, 0x0000, 0x000B, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF,
+    0x009F, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF,
+    0x009F, 0x9240, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x9240, 0x0028, 0xFFFF, 0x002A, 0xFFFF,
+    0x009D, 0x9240, 0x0029, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x9240, 0x0029, 0xFFFF, 0x002A, 0xFFFF,
+    0x009D, 0x9240, 0x0029, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x9240, 0x0029, 0xFFFF, 0x002A, 0xFFFF,
+    0x009D, 0x9240, 0x0029, 0xFFFF, 0x002B, 0xFFFF, 0x009B, 0x9240, 0x002A, 0xFFFF, 0x002B, 0xFFFF,
+    0x009B, 0x9240, 0x002A, 0xFFFF, 0x002B, 0xFFFF, 0x009B, 0x9240, 0x002A, 0xFFFF, 0x002B, 0xFFFF,
+    0x009B, 0x9240, 0x002A, 0xFFFF, 0x002C, 0xFFFF, 0x0099, 0x9240, 0x002B, 0xFFFF, 0x002C, 0xFFFF,
+    0x0099, 0x9240, 0x002B, 0xFFFF, 0x002C, 0xFFFF, 0x0099, 0x9240, 0x002B, 0xFFFF, 0x002D, 0xFFFF,
+    0x0097, 0x9240, 0x002C, 0xFFFF, 0x002D, 0xFFFF, 0x0097, 0x9240, 0x002C, 0xFFFF, 0x002D, 0xFFFF,
+    0x0097, 0x9240, 0x002C, 0xFFFF, 0x002E, 0xFFFF, 0x0095, 0x9240, 0x002D, 0xFFFF, 0x002E, 0xFFFF,
+    0x0095, 0x9240, 0x002D, 0xFFFF, 0x002E, 0xFFFF, 0x0095, 0x9240, 0x002D, 0xFFFF, 0x002F, 0xFFFF,
+    0x0093, 0x9240, 0x002E, 0xFFFF, 0x002F, 0xFFFF, 0x0093, 0x9240, 0x002E, 0xFFFF, 0x0030, 0xFFFF,
+    0x0091, 0x9240, 0x002F, 0xFFFF, 0x0030, 0xFFFF, 0x0091, 0x9240, 0x002F, 0xFFFF, 0x0031, 0xFFFF,
+    0x008F, 0x9240, 0x0030, 0xFFFF, 0x0031, 0xFFFF, 0x008F, 0x9240, 0x0030, 0xFFFF, 0x0032, 0xFFFF,
+    0x008D, 0x9240, 0x0031, 0xFFFF, 0x0032, 0xFFFF, 0x008D, 0x9240, 0x0031, 0xFFFF, 0x0033, 0xFFFF,
+    0x008B, 0x9240, 0x0032, 0xFFFF, 0x0033, 0xFFFF, 0x008B, 0x9240, 0x0032, 0xFFFF, 0x0034, 0xFFFF,
+    0x0089, 0x9240, 0x0033, 0xFFFF, 0x0034, 0xFFFF, 0x0089, 0x9240, 0x0033, 0xFFFF, 0x0035, 0xFFFF,
+    0x0087, 0x9240, 0x0034, 0xFFFF, 0x0036, 0xFFFF, 0x0085, 0x9240, 0x0035, 0xFFFF, 0x0036, 0xFFFF,
+    0x0085, 0x9240, 0x0035, 0xFFFF, 0x0037, 0xFFFF, 0x0083, 0x9240, 0x0036, 0xFFFF, 0x0038, 0xFFFF,
+    0x0081, 0x9240, 0x0037, 0xFFFF, 0x0038, 0xFFFF, 0x0081, 0x9240, 0x0037, 0xFFFF, 0x0039, 0xFFFF,
+    0x007F, 0x9240, 0x0038, 0xFFFF, 0x003A, 0xFFFF, 0x007D, 0x9240, 0x0039, 0xFFFF, 0x003B, 0xFFFF,
+    0x007B, 0x9240, 0x003A, 0xFFFF, 0x003C, 0xFFFF, 0x0079, 0x9240, 0x003B, 0xFFFF, 0x003D, 0xFFFF,
+    0x0077, 0x9240, 0x003C, 0xFFFF, 0x003D, 0xFFFF, 0x0077, 0x9240, 0x003C, 0xFFFF, 0x003E, 0xFFFF,
+    0x0075, 0x9240, 0x003D, 0xFFFF, 0x003F, 0xFFFF, 0x0073, 0x9240, 0x003E, 0xFFFF, 0x0040, 0xFFFF,
+    0x0071, 0x9240, 0x003F, 0xFFFF, 0x0041, 0xFFFF, 0x006F, 0x9240, 0x0040, 0xFFFF, 0x0042, 0xFFFF,
+    0x006D, 0x9240, 0x0041, 0xFFFF, 0x0044, 0xFFFF, 0x0031, 0x9240, 0x000A, 0x0000, 0x002E, 0x9240,
+    0x0043, 0xFFFF, 0x0045, 0xFFFF, 0x0030, 0x9240, 0x000A, 0x0000, 0x002D, 0x9240, 0x0044, 0xFFFF,
+    0x0046, 0xFFFF, 0x002D, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x002A, 0x9240, 0x0045, 0xFFFF, 0x0047, 0xFFFF, 0x002C, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A,
+    0x9240, 0x8002, 0x0000, 0x0000, 0x0029, 0x9240, 0x0046, 0xFFFF, 0x0048, 0xFFFF, 0x002B, 0x9240,
+    0x8002, 0x0000, 0x0000, 0x0034, 0x9240, 0x0047, 0xFFFF, 0x004A, 0xFFFF, 0x0029, 0x9240, 0x8002,
+    0x0000, 0x0000, 0x0032, 0x9240, 0x0049, 0xFFFF, 0x004B, 0xFFFF, 0x002A, 0x9240, 0x000A, 0x0000,
+    0x0027, 0x9240, 0x004A, 0xFFFF, 0x004D, 0xFFFF, 0x0028, 0x9240, 0x000A, 0x0000, 0x0025, 0x9240,
+    0x004C, 0xFFFF, 0x004E, 0xFFFF, 0x0031, 0x9240, 0x8002, 0x0000, 0x0000, 0x0022, 0x9240, 0x004D,
+    0xFFFF, 0x0050, 0xFFFF, 0x002F, 0x9240, 0x8002, 0x0000, 0x0000, 0x0020, 0x9240, 0x004F, 0xFFFF,
+    0x0052, 0xFFFF, 0x0021, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A, 0x9240, 0x8002, 0x0000, 0x0000,
+    0x001E, 0x9240, 0x0051, 0xFFFF, 0x0054, 0xFFFF, 0x001F, 0x9240, 0x8002, 0x0000, 0x0000, 0x000A,
+    0x9240, 0x8002, 0x0000, 0x0000, 0x001C, 0x9240, 0x0053, 0xFFFF, 0x0056, 0xFFFF, 0x001F, 0x9240,
+    0x000A, 0x0000, 0x001C, 0x9240, 0x0055, 0xFFFF, 0x0058, 0xFFFF, 0x001D, 0x9240, 0x000A, 0x0000,
+    0x001A, 0x9240, 0x0057, 0xFFFF, 0x005A, 0xFFFF, 0x003D, 0x9240, 0x0059, 0xFFFF, 0x005D, 0xFFFF,
+    0x0037, 0x9240, 0x005C, 0xFFFF, 0x0060, 0xFFFF, 0x0031, 0x9240, 0x005F, 0xFFFF, 0x0063, 0xFFFF,
+    0x002B, 0x9240, 0x0062, 0xFFFF, 0x0067, 0xFFFF, 0x0023, 0x9240, 0x0066, 0xFFFF, 0x006C, 0xFFFF,
+    0x0019, 0x9240, 0x006B, 0xFFFF, 0x0078, 0xFFFF, 0x8001, 0x9240, 0x0077, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+};
+
+static const uint16_t bg_location_rows[320] = {
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0012, 0x0014, 0x001A,
+    0x0020, 0x0026, 0x002C, 0x0032, 0x0038, 0x003E, 0x0044, 0x0059, 0x006E, 0x0082, 0x0096, 0x00C7,
+    0x00F8, 0x0139, 0x017A, 0x01B6, 0x01F2, 0x0242, 0x0292, 0x02C3, 0x02F4, 0x02FA, 0x0300, 0x0306,
+    0x030C, 0x0312, 0x0318, 0x031E, 0x0324, 0x0326, 0x0328, 0x032A, 0x032C, 0x032E, 0x0330, 0x0332,
+    0x0334, 0x0336, 0x0338, 0x0344, 0x0350, 0x0360, 0x0370, 0x0383, 0x0396, 0x03A7, 0x03B8, 0x03C8,
+    0x03D8, 0x03F7, 0x0416, 0x0428, 0x043A, 0x043C, 0x043E, 0x0440, 0x0442, 0x0444, 0x0446, 0x044D,
+    0x0454, 0x045F, 0x046A, 0x0482, 0x049A, 0x04B4, 0x04CE, 0x04E9, 0x0504, 0x0523, 0x0542, 0x055A,
+    0x0572, 0x0574, 0x0576, 0x0578, 0x057A, 0x057C, 0x057E, 0x0580, 0x0582, 0x0584, 0x0586, 0x0588,
+    0x058A, 0x058C, 0x058E, 0x0590, 0x0592, 0x0594, 0x0596, 0x0598, 0x059A, 0x059C, 0x059E, 0x05A0,
+    0x05A2, 0x05A4, 0x05A6, 0x05A8, 0x05AA, 0x05AC, 0x05AE, 0x05B0, 0x05B2, 0x05B4, 0x05B6, 0x05B8,
+    0x05BA, 0x05C0, 0x05C6, 0x05CC, 0x05D2, 0x05D8, 0x05DE, 0x05E4, 0x05EA, 0x05F0, 0x05F6, 0x0606,
+    0x0616, 0x0625, 0x0634, 0x0648, 0x065C, 0x0671, 0x0686, 0x069A, 0x06AE, 0x06BD, 0x06CC, 0x06DC,
+    0x06EC, 0x06F2, 0x06F8, 0x06FE, 0x0704, 0x070A, 0x0710, 0x0716, 0x071C, 0x0722, 0x0728, 0x072E,
+    0x0734, 0x073A, 0x0740, 0x0746, 0x074C, 0x0752, 0x0758, 0x075E, 0x0764, 0x076A, 0x0770, 0x0776,
+    0x077C, 0x0782, 0x0788, 0x078E, 0x0794, 0x079A, 0x07A0, 0x07A6, 0x07AC, 0x07B2, 0x07B8, 0x07BE,
+    0x07C4, 0x07CA, 0x07D0, 0x07D6, 0x07DC, 0x07E2, 0x07E8, 0x07EE, 0x07F4, 0x07FA, 0x0800, 0x0806,
+    0x080C, 0x0812, 0x0818, 0x081E, 0x0832, 0x0846, 0x085B, 0x0870, 0x0885, 0x089A, 0x08B3, 0x08CC,
+    0x08E8, 0x0904, 0x0917, 0x092A, 0x093E, 0x0952, 0x0958, 0x095E, 0x0964, 0x096A, 0x0970, 0x0976,
+    0x097C, 0x0982, 0x0988, 0x098E, 0x0994, 0x099A, 0x09A0, 0x09A6, 0x09AC, 0x09B2, 0x09B8, 0x09BE,
+    0x09C4, 0x09CA, 0x09D0, 0x09D6, 0x09DC, 0x09E2, 0x09E8, 0x09EE, 0x09F4, 0x09FA, 0x0A00, 0x0A06,
+    0x0A0C, 0x0A12, 0x0A18, 0x0A1E, 0x0A24, 0x0A2A, 0x0A30, 0x0A36, 0x0A3C, 0x0A42, 0x0A48, 0x0A4E,
+    0x0A54, 0x0A5A, 0x0A60, 0x0A66, 0x0A6C, 0x0A72, 0x0A78, 0x0A7E, 0x0A84, 0x0A8E, 0x0A98, 0x0AA8,
+    0x0AB8, 0x0AC3, 0x0ACE, 0x0AD8, 0x0AE2, 0x0AED, 0x0AF8, 0x0B08, 0x0B18, 0x0B22, 0x0B2C, 0x0B32,
+    0x0B38, 0x0B3E, 0x0B44, 0x0B4A, 0x0B50, 0x0B56, 0x0B58, 0x0B5A, 0x0B5C, 0x0B5E, 0x0B60, 0x0B62,
+    0x0B64, 0x0B66, 0x0B68, 0x0B6A, 0x0B6C, 0x0B6E, 0x0B70, 0x0B72, 0x0B74, 0x0B76, 0x0B78, 0x0B7A,
+    0x0B7C, 0x0B7E, 0x0B80, 0x0B82, 0x0B84, 0x0B86, 0x0B88, 0x0B8A, 0x0B8C, 0x0B8E, 0x0B90, 0x0B92,
+    0x0B94, 0x0B96, 0x0B98, 0x0B9A, 0x0B9C, 0x0B9E, 0x0BA0, 0x0BA2,
+};
+
+const bg_image_t bg_location = { 240, 320, bg_location_rows, bg_location_data };
+
+// bg_time: 3264 words for 76800 pixels
+static const uint16_t bg_time_data[3264] = {
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x0400,
+    0x000E, 0xFFFF, 0x0007, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x00BB, 0x0400, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000A, 0x0400, 0x000E, 0xFFFF, 0x0007, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x00BB, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0040, 0x0400, 0x0004,
+    0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0040, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x0006, 0xFFFF,
+    0x8002, 0x0400, 0x0400, 0x0004, 0xFFFF, 0x0007, 0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400, 0x0004,
+    0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x0006, 0xFFFF, 0x8002, 0x0400, 0x0400,
+    0x0004, 0xFFFF, 0x0007, 0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0091, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0091, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x000E, 0xFFFF, 0x0091, 0x0400, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x000E, 0xFFFF, 0x0091, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0003, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x0400,
+    0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0400, 0x000A,
+    0xFFFF, 0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0005, 0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF,
+    0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000,
+    0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF,
+    0x0004, 0x0000, 0x007F, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF,
+    0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000,
+    0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF,
+    0x0004, 0x0000, 0x007F, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0078, 0xFFFF, 0x8001, 0x0400, 0x0077, 0xFFFF, 0x006A, 0xFFFF,
+    0x001D, 0x0400, 0x0069, 0xFFFF, 0x0065, 0xFFFF, 0x0027, 0x0400, 0x0064, 0xFFFF, 0x0060, 0xFFFF,
+    0x0031, 0x0400, 0x005F, 0xFFFF, 0x005C, 0xFFFF, 0x0039, 0x0400, 0x005B, 0xFFFF, 0x0059, 0xFFFF,
+    0x0016, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x000A, 0xFFFF, 0x0012, 0x0400, 0x0058,
+    0xFFFF, 0x0056, 0xFFFF, 0x0019, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x000A, 0xFFFF,
+    0x0015, 0x0400, 0x0055, 0xFFFF, 0x0054, 0xFFFF, 0x0019, 0x0400, 0x0004, 0xFFFF, 0x0009, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0015, 0x0400, 0x0053, 0xFFFF,
+    0x0051, 0xFFFF, 0x001C, 0x0400, 0x0004, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0018, 0x0400, 0x0050, 0xFFFF, 0x004F, 0xFFFF, 0x0020, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0015, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x001A, 0x0400, 0x004E, 0xFFFF,
+    0x004D, 0xFFFF, 0x0022, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0015, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x001C, 0x0400, 0x004C, 0xFFFF, 0x004B, 0xFFFF, 0x0024, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B,
+    0x0400, 0x000A, 0xFFFF, 0x0020, 0x0400, 0x004A, 0xFFFF, 0x0049, 0xFFFF, 0x0026, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x000A, 0xFFFF, 0x0022, 0x0400, 0x0048, 0xFFFF, 0x0047, 0xFFFF,
+    0x0028, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x002E, 0x0400,
+    0x0046, 0xFFFF, 0x0045, 0xFFFF, 0x002A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0030, 0x0400, 0x0044, 0xFFFF, 0x0044, 0xFFFF, 0x002B, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0031, 0x0400, 0x0043, 0xFFFF, 0x0042, 0xFFFF,
+    0x002D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0033, 0x0400,
+    0x0041, 0xFFFF, 0x0041, 0xFFFF, 0x002C, 0x0400, 0x0006, 0xFFFF, 0x0007, 0x0400, 0x000E, 0xFFFF,
+    0x0028, 0x0400, 0x0040, 0xFFFF, 0x003F, 0xFFFF, 0x002E, 0x0400, 0x0006, 0xFFFF, 0x0007, 0x0400,
+    0x000E, 0xFFFF, 0x002A, 0x0400, 0x003E, 0xFFFF, 0x003E, 0xFFFF, 0x0075, 0x0400, 0x003D, 0xFFFF,
+    0x003C, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0047, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0012, 0x0400, 0x003B, 0xFFFF, 0x003B, 0xFFFF, 0x000C,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0047, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0013, 0x0400, 0x003A, 0xFFFF, 0x003A, 0xFFFF, 0x000B, 0x0400, 0x0004, 0xFFFF,
+    0x000D, 0x0400, 0x0004, 0xFFFF, 0x0045, 0x0400, 0x0004, 0xFFFF, 0x0014, 0x0400, 0x0039, 0xFFFF,
+    0x0039, 0xFFFF, 0x000C, 0x0400, 0x0004, 0xFFFF, 0x000D, 0x0400, 0x0004, 0xFFFF, 0x0045, 0x0400,
+    0x0004, 0xFFFF, 0x0015, 0x0400, 0x0038, 0xFFFF, 0x0038, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0047, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0016,
+    0x0400, 0x0037, 0xFFFF, 0x0036, 0xFFFF, 0x0011, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0047, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0018, 0x0400, 0x0035, 0xFFFF,
+    0x0035, 0xFFFF, 0x0012, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0047, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0019, 0x0400, 0x0034, 0xFFFF, 0x0034, 0xFFFF, 0x0013,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0047, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x001A, 0x0400, 0x0033, 0xFFFF, 0x0033, 0xFFFF, 0x0014, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0047, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x001B,
+    0x0400, 0x0032, 0xFFFF, 0x0032, 0xFFFF, 0x0015, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0047, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x001C, 0x0400, 0x0031, 0xFFFF,
+    0x0031, 0xFFFF, 0x0016, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0047, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x001D, 0x0400, 0x0030, 0xFFFF, 0x0030, 0xFFFF, 0x0017,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0047, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x001E, 0x0400, 0x002F, 0xFFFF, 0x002F, 0xFFFF, 0x0016, 0x0400, 0x0006, 0xFFFF,
+    0x000B, 0x0400, 0x0006, 0xFFFF, 0x0043, 0x0400, 0x0006, 0xFFFF, 0x001D, 0x0400, 0x002E, 0xFFFF,
+    0x002E, 0xFFFF, 0x0017, 0x0400, 0x0006, 0xFFFF, 0x000B, 0x0400, 0x0006, 0xFFFF, 0x0043, 0x0400,
+    0x0006, 0xFFFF, 0x001E, 0x0400, 0x002D, 0xFFFF, 0x002D, 0xFFFF, 0x0097, 0x0400, 0x002C, 0xFFFF,
+    0x002D, 0xFFFF, 0x0097, 0x0400, 0x002C, 0xFFFF, 0x002C, 0xFFFF, 0x0099, 0x0400, 0x002B, 0xFFFF,
+    0x002B, 0xFFFF, 0x009B, 0x0400, 0x002A, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x0400, 0x0029, 0xFFFF,
+    0x0029, 0xFFFF, 0x009F, 0x0400, 0x0028, 0xFFFF, 0x0028, 0xFFFF, 0x00A1, 0x0400, 0x0027, 0xFFFF,
+    0x0028, 0xFFFF, 0x00A1, 0x0400, 0x0027, 0xFFFF, 0x0027, 0xFFFF, 0x00A3, 0x0400, 0x0026, 0xFFFF,
+    0x0026, 0xFFFF, 0x00A5, 0x0400, 0x0025, 0xFFFF, 0x0026, 0xFFFF, 0x00A5, 0x0400, 0x0025, 0xFFFF,
+    0x0025, 0xFFFF, 0x00A7, 0x0400, 0x0024, 0xFFFF, 0x0024, 0xFFFF, 0x00A9, 0x0400, 0x0023, 0xFFFF,
+    0x0024, 0xFFFF, 0x00A9, 0x0400, 0x0023, 0xFFFF, 0x0023, 0xFFFF, 0x00AB, 0x0400, 0x0022, 0xFFFF,
+    0x0022, 0xFFFF, 0x00AD, 0x0400, 0x0021, 0xFFFF, 0x0022, 0xFFFF, 0x00AD, 0x0400, 0x0021, 0xFFFF,
+    0x0021, 0xFFFF, 0x00AF, 0x0400, 0x0020, 0xFFFF, 0x0021, 0xFFFF, 0x00AF, 0x0400, 0x0020, 0xFFFF,
+    0x0020, 0xFFFF, 0x00B1, 0x0400, 0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x00B1, 0x0400, 0x001F, 0xFFFF,
+    0x001F, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x000A, 0xFFFF, 0x007B,
+    0x0400, 0x000A, 0xFFFF, 0x000D, 0x0400, 0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x000A, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x000A, 0xFFFF, 0x007B, 0x0400, 0x000A, 0xFFFF, 0x000D, 0x0400,
+    0x001E, 0xFFFF, 0x001E, 0xFFFF, 0x0009, 0x0400, 0x0004, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0077, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000C, 0x0400, 0x001D, 0xFFFF, 0x001E, 0xFFFF, 0x0009, 0x0400,
+    0x0004, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0077, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000C, 0x0400,
+    0x001D, 0xFFFF, 0x001D, 0xFFFF, 0x000C, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x8006, 0xFFFF, 0xFFFF, 0x0400, 0x0400, 0xFFFF, 0xFFFF, 0x0083,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x001C, 0xFFFF, 0x001D, 0xFFFF, 0x000C, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x8006, 0xFFFF,
+    0xFFFF, 0x0400, 0x0400, 0xFFFF, 0xFFFF, 0x0083, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400,
+    0x001C, 0xFFFF, 0x001C, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0079, 0x0400, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x001B, 0xFFFF, 0x001C, 0xFFFF, 0x000D, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0079, 0x0400, 0x000A, 0xFFFF, 0x0010, 0x0400,
+    0x001B, 0xFFFF, 0x001C, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8006,
+    0xFFFF, 0xFFFF, 0x0400, 0x0400, 0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0077,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x001A, 0x0400, 0x001B, 0xFFFF, 0x001B, 0xFFFF, 0x000E, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8006, 0xFFFF, 0xFFFF, 0x0400, 0x0400, 0xFFFF, 0xFFFF,
+    0x0006, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0077, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x001B, 0x0400,
+    0x001A, 0xFFFF, 0x001B, 0xFFFF, 0x000E, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0077, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x001B, 0x0400, 0x001A, 0xFFFF, 0x001A, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0009,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0077, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x001C, 0x0400, 0x0019, 0xFFFF, 0x001A, 0xFFFF, 0x000D, 0x0400, 0x0006, 0xFFFF,
+    0x0009, 0x0400, 0x000A, 0xFFFF, 0x0079, 0x0400, 0x000E, 0xFFFF, 0x0010, 0x0400, 0x0019, 0xFFFF,
+    0x001A, 0xFFFF, 0x000D, 0x0400, 0x0006, 0xFFFF, 0x0009, 0x0400, 0x000A, 0xFFFF, 0x0079, 0x0400,
+    0x000E, 0xFFFF, 0x0010, 0x0400, 0x0019, 0xFFFF, 0x0019, 0xFFFF, 0x00BF, 0x0400, 0x0018, 0xFFFF,
+    0x0019, 0xFFFF, 0x00BF, 0x0400, 0x0018, 0xFFFF, 0x0019, 0xFFFF, 0x00BF, 0x0400, 0x0018, 0xFFFF,
+    0x0018, 0xFFFF, 0x00C1, 0x0400, 0x0017, 0xFFFF, 0x0018, 0xFFFF, 0x00C1, 0x0400, 0x0017, 0xFFFF,
+    0x0018, 0xFFFF, 0x00C1, 0x0400, 0x0017, 0xFFFF, 0x0018, 0xFFFF, 0x00C1, 0x0400, 0x0017, 0xFFFF,
+    0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF, 0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF,
+    0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF, 0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF,
+    0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400, 0x0015, 0xFFFF,
+    0x0016, 0xFFFF, 0x00C5, 0x0400, 0x0015, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400, 0x0015, 0xFFFF,
+    0x0016, 0xFFFF, 0x00C5, 0x0400, 0x0015, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400, 0x0015, 0xFFFF,
+    0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF,
+    0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF,
+    0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF,
+    0x0015, 0xFFFF, 0x0006, 0x0400, 0x000A, 0xFFFF, 0x00A5, 0x0400, 0x000A, 0xFFFF, 0x0008, 0x0400,
+    0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x0006, 0x0400, 0x000A, 0xFFFF, 0x00A5, 0x0400, 0x000A, 0xFFFF,
+    0x0008, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0051, 0x0400, 0x8001, 0xFFFF, 0x004F, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF,
+    0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004E, 0x0400,
+    0x0007, 0xFFFF, 0x004C, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0006, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004D, 0x0400, 0x0009, 0xFFFF, 0x0057, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0006, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004C, 0x0400, 0x000B, 0xFFFF, 0x0056, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x0006, 0x0400, 0x000C, 0xFFFF,
+    0x004C, 0x0400, 0x000B, 0xFFFF, 0x004E, 0x0400, 0x0008, 0xFFFF, 0x0008, 0x0400, 0x0014, 0xFFFF,
+    0x0015, 0xFFFF, 0x0006, 0x0400, 0x000C, 0xFFFF, 0x004C, 0x0400, 0x000B, 0xFFFF, 0x004E, 0x0400,
+    0x0008, 0xFFFF, 0x0008, 0x0400, 0x0014, 0xFFFF, 0x0014, 0xFFFF, 0x0011, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x004B, 0x0400, 0x000D, 0xFFFF, 0x0055, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0400,
+    0x0013, 0xFFFF, 0x0015, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004C, 0x0400, 0x000B,
+    0xFFFF, 0x0056, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF,
+    0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004C, 0x0400,
+    0x000B, 0xFFFF, 0x004A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0006, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004C, 0x0400, 0x000B, 0xFFFF, 0x004A, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF,
+    0x0006, 0x0400, 0x000A, 0xFFFF, 0x004F, 0x0400, 0x0009, 0xFFFF, 0x004D, 0x0400, 0x000A, 0xFFFF,
+    0x0008, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x0006, 0x0400, 0x000A, 0xFFFF, 0x0050, 0x0400,
+    0x0007, 0xFFFF, 0x004E, 0x0400, 0x000A, 0xFFFF, 0x0008, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF,
+    0x0063, 0x0400, 0x8001, 0xFFFF, 0x0063, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400,
+    0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400,
+    0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400,
+    0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400,
+    0x0014, 0xFFFF, 0x0015, 0xFFFF, 0x00C7, 0x0400, 0x0014, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400,
+    0x0015, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400, 0x0015, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400,
+    0x0015, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400, 0x0015, 0xFFFF, 0x0016, 0xFFFF, 0x00C5, 0x0400,
+    0x0015, 0xFFFF, 0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF, 0x0017, 0xFFFF, 0x00C3, 0x0400,
+    0x0016, 0xFFFF, 0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF, 0x0017, 0xFFFF, 0x00C3, 0x0400,
+    0x0016, 0xFFFF, 0x0017, 0xFFFF, 0x00C3, 0x0400, 0x0016, 0xFFFF, 0x0018, 0xFFFF, 0x00C1, 0x0400,
+    0x0017, 0xFFFF, 0x0018, 0xFFFF, 0x00C1, 0x0400, 0x0017, 0xFFFF, 0x0018, 0xFFFF, 0x00C1, 0x0400,
+    0x0017, 0xFFFF, 0x0018, 0xFFFF, 0x00C1, 0x0400, 0x0017, 0xFFFF, 0x0019, 0xFFFF, 0x000C, 0x0400,
+    0x000A, 0xFFFF, 0x0092, 0x0400, 0x0004, 0xFFFF, 0x0013, 0x0400, 0x0018, 0xFFFF, 0x0019, 0xFFFF,
+    0x000C, 0x0400, 0x000A, 0xFFFF, 0x0092, 0x0400, 0x0004, 0xFFFF, 0x0013, 0x0400, 0x0018, 0xFFFF,
+    0x0019, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x008E, 0x0400, 0x8006, 0xFFFF, 0xFFFF, 0x0400, 0x0400, 0xFFFF, 0xFFFF, 0x0013, 0x0400, 0x0018,
+    0xFFFF, 0x001A, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x008E, 0x0400, 0x8006, 0xFFFF, 0xFFFF, 0x0400, 0x0400, 0xFFFF, 0xFFFF, 0x0012, 0x0400,
+    0x0019, 0xFFFF, 0x001A, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x008C, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0012, 0x0400, 0x0019, 0xFFFF, 0x001A, 0xFFFF, 0x0009, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x008C, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0012, 0x0400, 0x0019, 0xFFFF, 0x001B, 0xFFFF, 0x000A, 0x0400, 0x000A, 0xFFFF,
+    0x008C, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0x0400,
+    0x001A, 0xFFFF, 0x001B, 0xFFFF, 0x000A, 0x0400, 0x000A, 0xFFFF, 0x008C, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0006, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0x0400, 0x001A, 0xFFFF, 0x001C, 0xFFFF,
+    0x0007, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0088, 0x0400,
+    0x000E, 0xFFFF, 0x000E, 0x0400, 0x001B, 0xFFFF, 0x001C, 0xFFFF, 0x0007, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0088, 0x0400, 0x000E, 0xFFFF, 0x000E, 0x0400,
+    0x001B, 0xFFFF, 0x001C, 0xFFFF, 0x0007, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0092, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0010, 0x0400, 0x001B, 0xFFFF, 0x001D,
+    0xFFFF, 0x0006, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0092,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x001C, 0xFFFF, 0x001D, 0xFFFF, 0x0008, 0x0400,
+    0x000A, 0xFFFF, 0x0094, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x001C, 0xFFFF, 0x001E,
+    0xFFFF, 0x0007, 0x0400, 0x000A, 0xFFFF, 0x0094, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000E, 0x0400,
+    0x001D, 0xFFFF, 0x001E, 0xFFFF, 0x00B5, 0x0400, 0x001D, 0xFFFF, 0x001F, 0xFFFF, 0x00B3, 0x0400,
+    0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x00B3, 0x0400, 0x001E, 0xFFFF, 0x0020, 0xFFFF, 0x00B1, 0x0400,
+    0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x00B1, 0x0400, 0x001F, 0xFFFF, 0x0021, 0xFFFF, 0x00AF, 0x0400,
+    0x0020, 0xFFFF, 0x0021, 0xFFFF, 0x00AF, 0x0400, 0x0020, 0xFFFF, 0x0022, 0xFFFF, 0x00AD, 0x0400,
+    0x0021, 0xFFFF, 0x0022, 0xFFFF, 0x00AD, 0x0400, 0x0021, 0xFFFF, 0x0023, 0xFFFF, 0x00AB, 0x0400,
+    0x0022, 0xFFFF, 0x0024, 0xFFFF, 0x00A9, 0x0400, 0x0023, 0xFFFF, 0x0024, 0xFFFF, 0x00A9, 0x0400,
+    0x0023, 0xFFFF, 0x0025, 0xFFFF, 0x00A7, 0x0400, 0x0024, 0xFFFF, 0x0026, 0xFFFF, 0x00A5, 0x0400,
+    0x0025, 0xFFFF, 0x0026, 0xFFFF, 0x00A5, 0x0400, 0x0025, 0xFFFF, 0x0027, 0xFFFF, 0x00A3, 0x0400,
+    0x0026, 0xFFFF, 0x0028, 0xFFFF, 0x00A1, 0x0400, 0x0027, 0xFFFF, 0x0028, 0xFFFF, 0x00A1, 0x0400,
+    0x0027, 0xFFFF, 0x0029, 0xFFFF, 0x009F, 0x0400, 0x0028, 0xFFFF, 0x002A, 0xFFFF, 0x009D, 0x0400,
+    0x0029, 0xFFFF, 0x002B, 0xFFFF, 0x009B, 0x0400, 0x002A, 0xFFFF, 0x002C, 0xFFFF, 0x0015, 0x0400,
+    0x000E, 0xFFFF, 0x004C, 0x0400, 0x000E, 0xFFFF, 0x001C, 0x0400, 0x002B, 0xFFFF, 0x002D, 0xFFFF,
+    0x0014, 0x0400, 0x000E, 0xFFFF, 0x004C, 0x0400, 0x000E, 0xFFFF, 0x001B, 0x0400, 0x002C, 0xFFFF,
+    0x002D, 0xFFFF, 0x0020, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004C, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0027, 0x0400, 0x002C, 0xFFFF, 0x002E, 0xFFFF, 0x001F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004C,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0026, 0x0400, 0x002D, 0xFFFF, 0x002F, 0xFFFF, 0x001C, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x004E, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0025, 0x0400, 0x002E, 0xFFFF,
+    0x0030, 0xFFFF, 0x001B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x004E, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0024, 0x0400, 0x002F, 0xFFFF, 0x0031, 0xFFFF, 0x0018, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0050,
+    0x0400, 0x000C, 0xFFFF, 0x0019, 0x0400, 0x0030, 0xFFFF, 0x0032, 0xFFFF, 0x0017, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0050, 0x0400, 0x000C, 0xFFFF, 0x0018, 0x0400, 0x0031, 0xFFFF, 0x0033, 0xFFFF,
+    0x0014, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x005E, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0015, 0x0400,
+    0x0032, 0xFFFF, 0x0034, 0xFFFF, 0x0013, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x005E, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0014, 0x0400, 0x0033, 0xFFFF, 0x0035, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0054, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0013,
+    0x0400, 0x0034, 0xFFFF, 0x0036, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0054, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0012, 0x0400, 0x0035, 0xFFFF,
+    0x0038, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0058, 0x0400, 0x000A, 0xFFFF, 0x0012,
+    0x0400, 0x0037, 0xFFFF, 0x0039, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0058, 0x0400,
+    0x000A, 0xFFFF, 0x0011, 0x0400, 0x0038, 0xFFFF, 0x003A, 0xFFFF, 0x007D, 0x0400, 0x0039, 0xFFFF,
+    0x003B, 0xFFFF, 0x007B, 0x0400, 0x003A, 0xFFFF, 0x003C, 0xFFFF, 0x0034, 0x0400, 0x000A, 0xFFFF,
+    0x003B, 0x0400, 0x003B, 0xFFFF, 0x003E, 0xFFFF, 0x0032, 0x0400, 0x000A, 0xFFFF, 0x0039, 0x0400,
+    0x003D, 0xFFFF, 0x003F, 0xFFFF, 0x002F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0036, 0x0400, 0x003E, 0xFFFF, 0x0041, 0xFFFF, 0x002D, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0034, 0x0400, 0x0040, 0xFFFF, 0x0042, 0xFFFF,
+    0x002C, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x003F, 0x0400, 0x0041, 0xFFFF, 0x0044, 0xFFFF, 0x002A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x003D, 0x0400, 0x0043, 0xFFFF, 0x0045, 0xFFFF, 0x0029, 0x0400,
+    0x000C, 0xFFFF, 0x0032, 0x0400, 0x0044, 0xFFFF, 0x0047, 0xFFFF, 0x0027, 0x0400, 0x000C, 0xFFFF,
+    0x0030, 0x0400, 0x0046, 0xFFFF, 0x0049, 0xFFFF, 0x0025, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x002C, 0x0400, 0x0048, 0xFFFF, 0x004B, 0xFFFF, 0x0023, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x002A, 0x0400, 0x004A, 0xFFFF,
+    0x004D, 0xFFFF, 0x0021, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0028, 0x0400, 0x004C, 0xFFFF, 0x004F, 0xFFFF, 0x001F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0026, 0x0400, 0x004E, 0xFFFF, 0x0051, 0xFFFF, 0x001F, 0x0400,
+    0x000A, 0xFFFF, 0x0026, 0x0400, 0x0050, 0xFFFF, 0x0054, 0xFFFF, 0x001C, 0x0400, 0x000A, 0xFFFF,
+    0x0023, 0x0400, 0x0053, 0xFFFF, 0x0056, 0xFFFF, 0x0045, 0x0400, 0x0055, 0xFFFF, 0x0059, 0xFFFF,
+    0x003F, 0x0400, 0x0058, 0xFFFF, 0x005C, 0xFFFF, 0x0039, 0x0400, 0x005B, 0xFFFF, 0x0060, 0xFFFF,
+    0x0031, 0x0400, 0x005F, 0xFFFF, 0x0065, 0xFFFF, 0x0027, 0x0400, 0x0064, 0xFFFF, 0x006A, 0xFFFF,
+    0x001D, 0x0400, 0x0069, 0xFFFF, 0x0078, 0xFFFF, 0x8001, 0x0400, 0x0077, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+};
+
+static const uint16_t bg_time_rows[320] = {
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0012, 0x0014, 0x001A,
+    0x0020, 0x0026, 0x002C, 0x0032, 0x0038, 0x003E, 0x0044, 0x0053, 0x0062, 0x0071, 0x0080, 0x00A1,
+    0x00C2, 0x00EB, 0x0114, 0x0137, 0x015A, 0x0182, 0x01AA, 0x01D1, 0x01F8, 0x01FE, 0x0204, 0x020A,
+    0x0210, 0x0216, 0x021C, 0x0222, 0x0228, 0x022A, 0x022C, 0x022E, 0x0230, 0x0232, 0x0234, 0x0236,
+    0x0238, 0x023A, 0x023C, 0x023E, 0x0240, 0x024A, 0x0254, 0x025E, 0x0268, 0x026A, 0x026C, 0x026E,
+    0x0270, 0x027A, 0x0284, 0x028E, 0x0298, 0x029A, 0x029C, 0x029E, 0x02A0, 0x02A2, 0x02A4, 0x02A6,
+    0x02A8, 0x02AA, 0x02AC, 0x02AE, 0x02B0, 0x02B2, 0x02B4, 0x02B6, 0x02B8, 0x02BA, 0x02BC, 0x02BE,
+    0x02C0, 0x02C2, 0x02C4, 0x02C6, 0x02C8, 0x02CA, 0x02CC, 0x02CE, 0x02D0, 0x02D2, 0x02D4, 0x02D6,
+    0x02D8, 0x02DA, 0x02DC, 0x02DE, 0x02E0, 0x02E6, 0x02EC, 0x02F2, 0x02F8, 0x02FE, 0x030D, 0x031C,
+    0x0330, 0x0344, 0x0354, 0x0364, 0x0373, 0x0382, 0x0392, 0x03A2, 0x03B2, 0x03C2, 0x03D0, 0x03DE,
+    0x03E4, 0x03F9, 0x040E, 0x0420, 0x0432, 0x0447, 0x045C, 0x0471, 0x0486, 0x049B, 0x04B0, 0x04C5,
+    0x04DA, 0x04EC, 0x04FE, 0x0504, 0x050A, 0x0510, 0x0516, 0x051C, 0x0522, 0x0528, 0x052E, 0x0534,
+    0x053A, 0x0540, 0x0546, 0x054C, 0x0552, 0x0558, 0x055E, 0x0564, 0x056A, 0x0570, 0x0576, 0x057C,
+    0x058F, 0x05A2, 0x05C0, 0x05DE, 0x05FC, 0x061A, 0x0638, 0x0656, 0x0674, 0x0692, 0x06AC, 0x06C6,
+    0x06D8, 0x06EA, 0x06F0, 0x06F6, 0x06FC, 0x0702, 0x0708, 0x070E, 0x0714, 0x071A, 0x0720, 0x0726,
+    0x072C, 0x0732, 0x0738, 0x073E, 0x0744, 0x074A, 0x0750, 0x0756, 0x075C, 0x0762, 0x0768, 0x076E,
+    0x0774, 0x0782, 0x0790, 0x07AE, 0x07CC, 0x07E5, 0x07FE, 0x0810, 0x0822, 0x0836, 0x084A, 0x0868,
+    0x0886, 0x0898, 0x08AA, 0x08B4, 0x08BA, 0x08C0, 0x08C6, 0x08CC, 0x08D2, 0x08D8, 0x08DE, 0x08E4,
+    0x08EA, 0x08F0, 0x08F6, 0x08FC, 0x0902, 0x0908, 0x090E, 0x0914, 0x091A, 0x0920, 0x0926, 0x092C,
+    0x0932, 0x0938, 0x0946, 0x0954, 0x096D, 0x0986, 0x09A0, 0x09BA, 0x09CE, 0x09E2, 0x09F6, 0x0A0A,
+    0x0A1F, 0x0A34, 0x0A43, 0x0A52, 0x0A58, 0x0A5E, 0x0A64, 0x0A6A, 0x0A70, 0x0A76, 0x0A7C, 0x0A82,
+    0x0A88, 0x0A8E, 0x0A94, 0x0A9A, 0x0AA0, 0x0AA6, 0x0AAC, 0x0AB2, 0x0AB8, 0x0ABE, 0x0AC4, 0x0ACA,
+    0x0AD0, 0x0ADE, 0x0AEC, 0x0AFC, 0x0B0C, 0x0B1C, 0x0B2C, 0x0B3B, 0x0B4A, 0x0B5A, 0x0B6A, 0x0B7F,
+    0x0B94, 0x0BA3, 0x0BB2, 0x0BB8, 0x0BBE, 0x0BC8, 0x0BD2, 0x0BE2, 0x0BF2, 0x0BFD, 0x0C08, 0x0C12,
+    0x0C1C, 0x0C2C, 0x0C3C, 0x0C4C, 0x0C5C, 0x0C66, 0x0C70, 0x0C76, 0x0C7C, 0x0C82, 0x0C88, 0x0C8E,
+    0x0C94, 0x0C9A, 0x0C9C, 0x0C9E, 0x0CA0, 0x0CA2, 0x0CA4, 0x0CA6, 0x0CA8, 0x0CAA, 0x0CAC, 0x0CAE,
+    0x0CB0, 0x0CB2, 0x0CB4, 0x0CB6, 0x0CB8, 0x0CBA, 0x0CBC, 0x0CBE,
+};
+
+const bg_image_t bg_time = { 240, 320, bg_time_rows, bg_time_data };
+
+// bg_sky: 5232 words for 76800 pixels
+static const uint16_t bg_sky_data[5232] = {
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x0400,
+    0x000A, 0xFFFF, 0x001A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x00AA, 0x0400, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000C, 0x0400, 0x000A, 0xFFFF, 0x001A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x00AA, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0018, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0020, 0x0400, 0x0004, 0xFFFF, 0x0086,
+    0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0018, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0020, 0x0400, 0x0004, 0xFFFF,
+    0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0011,
+    0x0400, 0x000A, 0xFFFF, 0x0005, 0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400, 0x000C, 0xFFFF, 0x0007,
+    0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0011, 0x0400, 0x000A, 0xFFFF, 0x0005, 0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400,
+    0x000C, 0xFFFF, 0x0007, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x000C, 0x0400, 0x000A, 0xFFFF, 0x0011, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x009D, 0x0400, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000C, 0x0400, 0x000A, 0xFFFF, 0x0011, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x009D, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x0016, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0400, 0x000C, 0xFFFF, 0x0007,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x000A, 0xFFFF, 0x0093, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x0016, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0400, 0x000C, 0xFFFF, 0x0007,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x000A, 0xFFFF, 0x0093, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0003, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0007, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0006, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x0400,
+    0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x0400, 0x000A, 0xFFFF,
+    0x0007, 0x0400, 0x000C, 0xFFFF, 0x0009, 0x0400, 0x0006, 0xFFFF, 0x0005, 0x0400, 0x000C, 0xFFFF,
+    0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x0400,
+    0x000A, 0xFFFF, 0x0007, 0x0400, 0x000C, 0xFFFF, 0x0009, 0x0400, 0x0006, 0xFFFF, 0x0005, 0x0400,
+    0x000C, 0xFFFF, 0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x0004, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F,
+    0xFFFF, 0x0073, 0xFFFF, 0x0004, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF,
+    0x0073, 0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F,
+    0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006,
+    0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x006F, 0xFFFF, 0x0073, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8006, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000,
+    0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x0004, 0x0000, 0x006F,
+    0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x0004, 0x0000, 0x006F, 0xFFFF,
+    0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF,
+    0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x006F, 0xFFFF, 0x0013, 0x8410, 0x006E, 0xFFFF, 0x0068, 0xFFFF, 0x0007, 0x8410, 0x0009, 0x0008,
+    0x8001, 0x8410, 0x0009, 0x0008, 0x0007, 0x8410, 0x0067, 0xFFFF, 0x0063, 0xFFFF, 0x0005, 0x8410,
+    0x0010, 0x0008, 0x8001, 0x8410, 0x0010, 0x0008, 0x0005, 0x8410, 0x0062, 0xFFFF, 0x0060, 0xFFFF,
+    0x0003, 0x8410, 0x0015, 0x0008, 0x8001, 0x8410, 0x0015, 0x0008, 0x0003, 0x8410, 0x005F, 0xFFFF,
+    0x005C, 0xFFFF, 0x0004, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008, 0x0004, 0x8410,
+    0x005B, 0xFFFF, 0x0059, 0xFFFF, 0x0003, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008,
+    0x0003, 0x8410, 0x0058, 0xFFFF, 0x0057, 0xFFFF, 0x0003, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x0003, 0x8410, 0x0056, 0xFFFF, 0x0054, 0xFFFF, 0x0003, 0x8410, 0x0021, 0x0008,
+    0x8001, 0x8410, 0x0021, 0x0008, 0x0003, 0x8410, 0x0053, 0xFFFF, 0x0052, 0xFFFF, 0x0003, 0x8410,
+    0x0023, 0x0008, 0x8001, 0x8410, 0x0023, 0x0008, 0x0003, 0x8410, 0x0051, 0xFFFF, 0x0050, 0xFFFF,
+    0x8002, 0x8410, 0x8410, 0x0026, 0x0008, 0x8001, 0x8410, 0x0026, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x004F, 0xFFFF, 0x004E, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0028, 0x0008, 0x8001, 0x8410, 0x0028,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x004D, 0xFFFF, 0x004C, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002A,
+    0x0008, 0x8001, 0x8410, 0x002A, 0x0008, 0x8002, 0x8410, 0x8410, 0x004B, 0xFFFF, 0x004B, 0xFFFF,
+    0x8002, 0x8410, 0x8410, 0x002B, 0x0008, 0x8001, 0x8410, 0x002B, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x004A, 0xFFFF, 0x0049, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002D, 0x0008, 0x8001, 0x8410, 0x002D,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0048, 0xFFFF, 0x0047, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002F,
+    0x0008, 0x8001, 0x8410, 0x002F, 0x0008, 0x8002, 0x8410, 0x8410, 0x0046, 0xFFFF, 0x0046, 0xFFFF,
+    0x8002, 0x8410, 0x8410, 0x0030, 0x0008, 0x8001, 0x8410, 0x0030, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x0045, 0xFFFF, 0x0044, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410, 0x0032,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0043, 0xFFFF, 0x0043, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0033,
+    0x0008, 0x8001, 0x8410, 0x0033, 0x0008, 0x8002, 0x8410, 0x8410, 0x0042, 0xFFFF, 0x0042, 0xFFFF,
+    0x8001, 0x8410, 0x0035, 0x0008, 0x8001, 0x8410, 0x0035, 0x0008, 0x8001, 0x8410, 0x0041, 0xFFFF,
+    0x0040, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0036, 0x0008, 0x8001, 0x8410, 0x0036, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x003F, 0xFFFF, 0x003F, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0037, 0x0008, 0x8001,
+    0x8410, 0x0037, 0x0008, 0x8002, 0x8410, 0x8410, 0x003E, 0xFFFF, 0x003E, 0xFFFF, 0x8001, 0x8410,
+    0x0039, 0x0008, 0x8001, 0x8410, 0x0039, 0x0008, 0x8001, 0x8410, 0x003D, 0xFFFF, 0x003D, 0xFFFF,
+    0x8001, 0x8410, 0x003A, 0x0008, 0x8001, 0x8410, 0x003A, 0x0008, 0x8001, 0x8410, 0x003C, 0xFFFF,
+    0x003C, 0xFFFF, 0x8001, 0x8410, 0x003B, 0x0008, 0x8001, 0x8410, 0x003B, 0x0008, 0x8001, 0x8410,
+    0x003B, 0xFFFF, 0x003B, 0xFFFF, 0x8001, 0x8410, 0x003C, 0x0008, 0x8001, 0x8410, 0x003C, 0x0008,
+    0x8001, 0x8410, 0x003A, 0xFFFF, 0x003A, 0xFFFF, 0x8001, 0x8410, 0x003D, 0x0008, 0x8001, 0x8410,
+    0x003D, 0x0008, 0x8001, 0x8410, 0x0039, 0xFFFF, 0x0039, 0xFFFF, 0x8001, 0x8410, 0x003E, 0x0008,
+    0x8001, 0x8410, 0x003E, 0x0008, 0x8001, 0x8410, 0x0038, 0xFFFF, 0x0038, 0xFFFF, 0x8001, 0x8410,
+    0x003F, 0x0008, 0x8001, 0x8410, 0x003F, 0x0008, 0x8001, 0x8410, 0x0037, 0xFFFF, 0x0037, 0xFFFF,
+    0x8001, 0x8410, 0x0040, 0x0008, 0x8001, 0x8410, 0x0040, 0x0008, 0x8001, 0x8410, 0x0036, 0xFFFF,
+    0x0036, 0xFFFF, 0x8001, 0x8410, 0x0041, 0x0008, 0x8001, 0x8410, 0x0041, 0x0008, 0x8001, 0x8410,
+    0x0035, 0xFFFF, 0x0035, 0xFFFF, 0x8001, 0x8410, 0x003B, 0x0008, 0x000F, 0x8410, 0x003B, 0x0008,
+    0x8001, 0x8410, 0x0034, 0xFFFF, 0x0034, 0xFFFF, 0x8001, 0x8410, 0x0036, 0x0008, 0x0006, 0x8410,
+    0x0007, 0x0008, 0x8001, 0x8410, 0x0007, 0x0008, 0x0006, 0x8410, 0x0036, 0x0008, 0x8001, 0x8410,
+    0x0033, 0xFFFF, 0x0033, 0xFFFF, 0x8001, 0x8410, 0x0033, 0x0008, 0x0004, 0x8410, 0x000D, 0x0008,
+    0x8001, 0x8410, 0x000D, 0x0008, 0x0004, 0x8410, 0x0033, 0x0008, 0x8001, 0x8410, 0x0032, 0xFFFF,
+    0x0032, 0xFFFF, 0x8001, 0x8410, 0x0031, 0x0008, 0x0003, 0x8410, 0x0011, 0x0008, 0x8001, 0x8410,
+    0x0011, 0x0008, 0x0003, 0x8410, 0x0031, 0x0008, 0x8001, 0x8410, 0x0031, 0xFFFF, 0x0031, 0xFFFF,
+    0x8002, 0x8410, 0x8410, 0x002F, 0x0008, 0x8002, 0x8410, 0x8410, 0x0014, 0x0008, 0x8001, 0x8410,
+    0x0014, 0x0008, 0x8002, 0x8410, 0x8410, 0x002F, 0x0008, 0x8002, 0x8410, 0x8410, 0x0030, 0xFFFF,
+    0x0031, 0xFFFF, 0x8001, 0x8410, 0x002D, 0x0008, 0x0003, 0x8410, 0x0016, 0x0008, 0x8001, 0x8410,
+    0x0016, 0x0008, 0x0003, 0x8410, 0x002D, 0x0008, 0x8001, 0x8410, 0x0030, 0xFFFF, 0x0030, 0xFFFF,
+    0x8001, 0x8410, 0x002C, 0x0008, 0x0003, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008,
+    0x0003, 0x8410, 0x002C, 0x0008, 0x8001, 0x8410, 0x002F, 0xFFFF, 0x002F, 0xFFFF, 0x8001, 0x8410,
+    0x002B, 0x0008, 0x8002, 0x8410, 0x8410, 0x001B, 0x0008, 0x8001, 0x8410, 0x001B, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x002B, 0x0008, 0x8001, 0x8410, 0x002E, 0xFFFF, 0x002E, 0xFFFF, 0x8002, 0x8410,
+    0x8410, 0x002A, 0x0008, 0x8002, 0x8410, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008,
+    0x8002, 0x8410, 0x8410, 0x002A, 0x0008, 0x8002, 0x8410, 0x8410, 0x002D, 0xFFFF, 0x002E, 0xFFFF,
+    0x8001, 0x8410, 0x0029, 0x0008, 0x8002, 0x8410, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0029, 0x0008, 0x8001, 0x8410, 0x002D, 0xFFFF, 0x002D, 0xFFFF,
+    0x8001, 0x8410, 0x0028, 0x0008, 0x8002, 0x8410, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0020,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0028, 0x0008, 0x8001, 0x8410, 0x002C, 0xFFFF, 0x002C, 0xFFFF,
+    0x8002, 0x8410, 0x8410, 0x0027, 0x0008, 0x8002, 0x8410, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410,
+    0x0021, 0x0008, 0x8002, 0x8410, 0x8410, 0x0027, 0x0008, 0x8002, 0x8410, 0x8410, 0x002B, 0xFFFF,
+    0x002C, 0xFFFF, 0x8001, 0x8410, 0x0027, 0x0008, 0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410,
+    0x0023, 0x0008, 0x8001, 0x8410, 0x0027, 0x0008, 0x8001, 0x8410, 0x002B, 0xFFFF, 0x002B, 0xFFFF,
+    0x8001, 0x8410, 0x0026, 0x0008, 0x8002, 0x8410, 0x8410, 0x0024, 0x0008, 0x8001, 0x8410, 0x0024,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0026, 0x0008, 0x8001, 0x8410, 0x002A, 0xFFFF, 0x002B, 0xFFFF,
+    0x8001, 0x8410, 0x0025, 0x0008, 0x8002, 0x8410, 0x8410, 0x0025, 0x0008, 0x8001, 0x8410, 0x0025,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0025, 0x0008, 0x8001, 0x8410, 0x002A, 0xFFFF, 0x002A, 0xFFFF,
+    0x8001, 0x8410, 0x0025, 0x0008, 0x8002, 0x8410, 0x8410, 0x0026, 0x0008, 0x8001, 0x8410, 0x0026,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0025, 0x0008, 0x8001, 0x8410, 0x0029, 0xFFFF, 0x0029, 0xFFFF,
+    0x8002, 0x8410, 0x8410, 0x0024, 0x0008, 0x8001, 0x8410, 0x0028, 0x0008, 0x8001, 0x8410, 0x0028,
+    0x0008, 0x8001, 0x8410, 0x0024, 0x0008, 0x8002, 0x8410, 0x8410, 0x0028, 0xFFFF, 0x0029, 0xFFFF,
+    0x8001, 0x8410, 0x0024, 0x0008, 0x8001, 0x8410, 0x0029, 0x0008, 0x8001, 0x8410, 0x0029, 0x0008,
+    0x8001, 0x8410, 0x0024, 0x0008, 0x8001, 0x8410, 0x0028, 0xFFFF, 0x0028, 0xFFFF, 0x8001, 0x8410,
+    0x0024, 0x0008, 0x8001, 0x8410, 0x002A, 0x0008, 0x8001, 0x8410, 0x002A, 0x0008, 0x8001, 0x8410,
+    0x0024, 0x0008, 0x8001, 0x8410, 0x0027, 0xFFFF, 0x0028, 0xFFFF, 0x8001, 0x8410, 0x0023, 0x0008,
+    0x8001, 0x8410, 0x002B, 0x0008, 0x8001, 0x8410, 0x002B, 0x0008, 0x8001, 0x8410, 0x0023, 0x0008,
+    0x8001, 0x8410, 0x0027, 0xFFFF, 0x0027, 0xFFFF, 0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410,
+    0x002C, 0x0008, 0x8001, 0x8410, 0x002C, 0x0008, 0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410,
+    0x0026, 0xFFFF, 0x0027, 0xFFFF, 0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410, 0x8410, 0x002C,
+    0x0008, 0x8001, 0x8410, 0x002C, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410,
+    0x0026, 0xFFFF, 0x0026, 0xFFFF, 0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410, 0x8410, 0x002D,
+    0x0008, 0x8001, 0x8410, 0x002D, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410,
+    0x0025, 0xFFFF, 0x0026, 0xFFFF, 0x8001, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x002E, 0x0008,
+    0x8001, 0x8410, 0x002E, 0x0008, 0x8001, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x0025, 0xFFFF,
+    0x0025, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x002F, 0x0008, 0x8001,
+    0x8410, 0x002F, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8002, 0x8410, 0x8410, 0x0024, 0xFFFF,
+    0x0025, 0xFFFF, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x0030, 0x0008, 0x8001, 0x8410,
+    0x0030, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x0024, 0xFFFF, 0x0025, 0xFFFF,
+    0x8001, 0x8410, 0x0020, 0x0008, 0x8002, 0x8410, 0x8410, 0x0030, 0x0008, 0x8001, 0x8410, 0x0030,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0024, 0xFFFF, 0x0024, 0xFFFF,
+    0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x0031, 0x0008, 0x8001, 0x8410, 0x0031, 0x0008,
+    0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x0023, 0xFFFF, 0x0024, 0xFFFF, 0x8001, 0x8410,
+    0x0020, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410,
+    0x0020, 0x0008, 0x8001, 0x8410, 0x0023, 0xFFFF, 0x0023, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0020,
+    0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410, 0x0020,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0xFFFF, 0x0023, 0xFFFF, 0x8001, 0x8410, 0x0020, 0x0008,
+    0x8001, 0x8410, 0x002E, 0x0008, 0x000B, 0x8410, 0x002E, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008,
+    0x8001, 0x8410, 0x0022, 0xFFFF, 0x0023, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x002A, 0x0008, 0x0004, 0x8410, 0x0005, 0x0008, 0x8001, 0x8410, 0x0005, 0x0008, 0x0004,
+    0x8410, 0x002A, 0x0008, 0x8002, 0x8410, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0022, 0xFFFF,
+    0x0022, 0xFFFF, 0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0028, 0x0008, 0x0003, 0x8410,
+    0x0009, 0x0008, 0x8001, 0x8410, 0x0009, 0x0008, 0x0003, 0x8410, 0x0028, 0x0008, 0x8001, 0x8410,
+    0x0020, 0x0008, 0x8001, 0x8410, 0x0021, 0xFFFF, 0x0022, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008,
+    0x8001, 0x8410, 0x0027, 0x0008, 0x0003, 0x8410, 0x000B, 0x0008, 0x8001, 0x8410, 0x000B, 0x0008,
+    0x0003, 0x8410, 0x0027, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0021, 0xFFFF,
+    0x0022, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0026, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x000D, 0x0008, 0x8001, 0x8410, 0x000D, 0x0008, 0x8002, 0x8410, 0x8410, 0x0026, 0x0008,
+    0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0021, 0xFFFF, 0x0022, 0xFFFF, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8002, 0x8410, 0x8410, 0x0024, 0x0008, 0x8002, 0x8410, 0x8410, 0x000F, 0x0008,
+    0x8001, 0x8410, 0x000F, 0x0008, 0x8002, 0x8410, 0x8410, 0x0024, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x0021, 0xFFFF, 0x0021, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008,
+    0x8001, 0x8410, 0x0024, 0x0008, 0x8001, 0x8410, 0x0011, 0x0008, 0x8001, 0x8410, 0x0011, 0x0008,
+    0x8001, 0x8410, 0x0024, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0020, 0xFFFF,
+    0x0021, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x0012, 0x0008, 0x8001, 0x8410, 0x0012, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008,
+    0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0020, 0xFFFF, 0x0021, 0xFFFF, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410, 0x8410, 0x0013, 0x0008, 0x8001,
+    0x8410, 0x0013, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x0020, 0xFFFF, 0x0020, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410,
+    0x0021, 0x0008, 0x8002, 0x8410, 0x8410, 0x0014, 0x0008, 0x8001, 0x8410, 0x0014, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x001F, 0xFFFF,
+    0x0020, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x0015, 0x0008, 0x8001, 0x8410, 0x0015, 0x0008, 0x8002, 0x8410, 0x8410, 0x0021, 0x0008,
+    0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x0016, 0x0008, 0x8001, 0x8410,
+    0x0016, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008,
+    0x8001, 0x8410, 0x0017, 0x0008, 0x8001, 0x8410, 0x0017, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008,
+    0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410,
+    0x0018, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001F, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008,
+    0x8001, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008,
+    0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0019, 0x0008, 0x8001, 0x8410,
+    0x0019, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8002, 0x8410, 0x8410, 0x0019, 0x0008, 0x8001, 0x8410, 0x0019, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x001A, 0x0008,
+    0x8001, 0x8410, 0x001A, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8002, 0x8410, 0x8410, 0x001A, 0x0008, 0x8001, 0x8410, 0x001A, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF,
+    0x001F, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001B, 0x0008, 0x8001, 0x8410, 0x001B, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001B, 0x0008, 0x8001, 0x8410, 0x001B, 0x0008,
+    0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF,
+    0x001E, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0xFFFF, 0x000B, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x000E, 0x0000,
+    0x000C, 0xFFFF, 0x000B, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0005, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x000E, 0x0000, 0x000C, 0xFFFF, 0x000B, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410,
+    0x001C, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0018, 0xFFFF, 0x000B, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001,
+    0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001,
+    0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0018, 0xFFFF, 0x000B, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0018,
+    0xFFFF, 0x000B, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005,
+    0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D,
+    0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D,
+    0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0018, 0xFFFF, 0x000B, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001,
+    0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001,
+    0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x000C, 0x0000, 0x000E, 0xFFFF, 0x000B,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x000C, 0x0000, 0x000E, 0xFFFF,
+    0x000B, 0xFFFF, 0x800E, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x00B5, 0x8410, 0x0003, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0018, 0xFFFF, 0x000B, 0xFFFF, 0x800E, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000,
+    0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001,
+    0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001,
+    0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001,
+    0x8410, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0018, 0xFFFF, 0x000B, 0xFFFF, 0x0004, 0x0000,
+    0x0006, 0xFFFF, 0x0004, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0018, 0xFFFF, 0x000B, 0xFFFF, 0x0004, 0x0000, 0x0006, 0xFFFF, 0x0004, 0x0000, 0x0005,
+    0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D,
+    0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D,
+    0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0018, 0xFFFF, 0x000B, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x0003, 0xFFFF, 0x000E, 0x0000, 0x000C, 0xFFFF, 0x000B, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x0003, 0xFFFF, 0x000E, 0x0000,
+    0x000C, 0xFFFF, 0x001E, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001D, 0xFFFF, 0x001E, 0xFFFF, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410,
+    0x001C, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001D, 0xFFFF, 0x001E, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0xFFFF, 0x001E, 0xFFFF, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410,
+    0x001C, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001D, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x001B, 0x0008, 0x8001, 0x8410, 0x001B, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001B, 0x0008, 0x8001, 0x8410,
+    0x001B, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410,
+    0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8002, 0x8410, 0x8410, 0x001A, 0x0008, 0x8001, 0x8410, 0x001A, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF,
+    0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x001A, 0x0008,
+    0x8001, 0x8410, 0x001A, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x001D, 0x0008,
+    0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8002, 0x8410, 0x8410, 0x0019, 0x0008, 0x8001, 0x8410, 0x0019, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF,
+    0x001F, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410,
+    0x0019, 0x0008, 0x8001, 0x8410, 0x0019, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF, 0x001F, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008,
+    0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0xFFFF,
+    0x0020, 0xFFFF, 0x8001, 0x8410, 0x001D, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410,
+    0x0018, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410,
+    0x001D, 0x0008, 0x8001, 0x8410, 0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0017, 0x0008, 0x8001, 0x8410, 0x0017, 0x0008,
+    0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001F, 0xFFFF,
+    0x0020, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410,
+    0x0016, 0x0008, 0x8001, 0x8410, 0x0016, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x8001, 0x8410, 0x001E, 0x0008,
+    0x8001, 0x8410, 0x0021, 0x0008, 0x8002, 0x8410, 0x8410, 0x0015, 0x0008, 0x8001, 0x8410, 0x0015,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410,
+    0x001F, 0xFFFF, 0x0020, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008,
+    0x8002, 0x8410, 0x8410, 0x0014, 0x0008, 0x8001, 0x8410, 0x0014, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x0021, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x001F, 0xFFFF, 0x0021, 0xFFFF,
+    0x8001, 0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410, 0x8410, 0x0013,
+    0x0008, 0x8001, 0x8410, 0x0013, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x0020, 0xFFFF, 0x0021, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008,
+    0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410, 0x8410, 0x0012, 0x0008, 0x8001, 0x8410, 0x0012,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410,
+    0x0020, 0xFFFF, 0x0021, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0024, 0x0008,
+    0x8001, 0x8410, 0x0011, 0x0008, 0x8001, 0x8410, 0x0011, 0x0008, 0x8001, 0x8410, 0x0024, 0x0008,
+    0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0020, 0xFFFF, 0x0022, 0xFFFF, 0x8001, 0x8410,
+    0x001E, 0x0008, 0x8002, 0x8410, 0x8410, 0x0024, 0x0008, 0x8002, 0x8410, 0x8410, 0x000F, 0x0008,
+    0x8001, 0x8410, 0x000F, 0x0008, 0x8002, 0x8410, 0x8410, 0x0024, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x0021, 0xFFFF, 0x0022, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008,
+    0x8001, 0x8410, 0x0026, 0x0008, 0x8002, 0x8410, 0x8410, 0x000D, 0x0008, 0x8001, 0x8410, 0x000D,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x0026, 0x0008, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410,
+    0x0021, 0xFFFF, 0x0022, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0027, 0x0008,
+    0x0003, 0x8410, 0x000B, 0x0008, 0x8001, 0x8410, 0x000B, 0x0008, 0x0003, 0x8410, 0x0027, 0x0008,
+    0x8001, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0021, 0xFFFF, 0x0022, 0xFFFF, 0x8001, 0x8410,
+    0x0020, 0x0008, 0x8001, 0x8410, 0x0028, 0x0008, 0x0003, 0x8410, 0x0009, 0x0008, 0x8001, 0x8410,
+    0x0009, 0x0008, 0x0003, 0x8410, 0x0028, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410,
+    0x0021, 0xFFFF, 0x0023, 0xFFFF, 0x8001, 0x8410, 0x001F, 0x0008, 0x8002, 0x8410, 0x8410, 0x002A,
+    0x0008, 0x0004, 0x8410, 0x0005, 0x0008, 0x8001, 0x8410, 0x0005, 0x0008, 0x0004, 0x8410, 0x002A,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x001F, 0x0008, 0x8001, 0x8410, 0x0022, 0xFFFF, 0x0023, 0xFFFF,
+    0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x002E, 0x0008, 0x000B, 0x8410, 0x002E, 0x0008,
+    0x8001, 0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0022, 0xFFFF, 0x0023, 0xFFFF, 0x8002, 0x8410,
+    0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001,
+    0x8410, 0x0020, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0xFFFF, 0x0024, 0xFFFF, 0x8001, 0x8410,
+    0x0020, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8001, 0x8410,
+    0x0020, 0x0008, 0x8001, 0x8410, 0x0023, 0xFFFF, 0x0024, 0xFFFF, 0x8001, 0x8410, 0x0021, 0x0008,
+    0x8001, 0x8410, 0x0031, 0x0008, 0x8001, 0x8410, 0x0031, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008,
+    0x8001, 0x8410, 0x0023, 0xFFFF, 0x0025, 0xFFFF, 0x8001, 0x8410, 0x0020, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x0030, 0x0008, 0x8001, 0x8410, 0x0030, 0x0008, 0x8002, 0x8410, 0x8410, 0x0020, 0x0008,
+    0x8001, 0x8410, 0x0024, 0xFFFF, 0x0025, 0xFFFF, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410,
+    0x0030, 0x0008, 0x8001, 0x8410, 0x0030, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410,
+    0x0024, 0xFFFF, 0x0025, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0021, 0x0008, 0x8001, 0x8410, 0x002F,
+    0x0008, 0x8001, 0x8410, 0x002F, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x0024, 0xFFFF, 0x0026, 0xFFFF, 0x8001, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x002E, 0x0008,
+    0x8001, 0x8410, 0x002E, 0x0008, 0x8001, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x0025, 0xFFFF,
+    0x0026, 0xFFFF, 0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410, 0x8410, 0x002D, 0x0008, 0x8001,
+    0x8410, 0x002D, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x0025, 0xFFFF,
+    0x0027, 0xFFFF, 0x8001, 0x8410, 0x0022, 0x0008, 0x8002, 0x8410, 0x8410, 0x002C, 0x0008, 0x8001,
+    0x8410, 0x002C, 0x0008, 0x8002, 0x8410, 0x8410, 0x0022, 0x0008, 0x8001, 0x8410, 0x0026, 0xFFFF,
+    0x0027, 0xFFFF, 0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410, 0x002C, 0x0008, 0x8001, 0x8410,
+    0x002C, 0x0008, 0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410, 0x0026, 0xFFFF, 0x0028, 0xFFFF,
+    0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410, 0x002B, 0x0008, 0x8001, 0x8410, 0x002B, 0x0008,
+    0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410, 0x0027, 0xFFFF, 0x0028, 0xFFFF, 0x8001, 0x8410,
+    0x0024, 0x0008, 0x8001, 0x8410, 0x002A, 0x0008, 0x8001, 0x8410, 0x002A, 0x0008, 0x8001, 0x8410,
+    0x0024, 0x0008, 0x8001, 0x8410, 0x0027, 0xFFFF, 0x0029, 0xFFFF, 0x8001, 0x8410, 0x0024, 0x0008,
+    0x8001, 0x8410, 0x0029, 0x0008, 0x8001, 0x8410, 0x0029, 0x0008, 0x8001, 0x8410, 0x0024, 0x0008,
+    0x8001, 0x8410, 0x0028, 0xFFFF, 0x0029, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0024, 0x0008, 0x8001,
+    0x8410, 0x0028, 0x0008, 0x8001, 0x8410, 0x0028, 0x0008, 0x8001, 0x8410, 0x0024, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x0028, 0xFFFF, 0x002A, 0xFFFF, 0x8001, 0x8410, 0x0025, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x0026, 0x0008, 0x8001, 0x8410, 0x0026, 0x0008, 0x8002, 0x8410, 0x8410, 0x0025, 0x0008,
+    0x8001, 0x8410, 0x0029, 0xFFFF, 0x002B, 0xFFFF, 0x8001, 0x8410, 0x0025, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x0025, 0x0008, 0x8001, 0x8410, 0x0025, 0x0008, 0x8002, 0x8410, 0x8410, 0x0025, 0x0008,
+    0x8001, 0x8410, 0x002A, 0xFFFF, 0x002B, 0xFFFF, 0x8001, 0x8410, 0x0026, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x0024, 0x0008, 0x8001, 0x8410, 0x0024, 0x0008, 0x8002, 0x8410, 0x8410, 0x0026, 0x0008,
+    0x8001, 0x8410, 0x002A, 0xFFFF, 0x002C, 0xFFFF, 0x8001, 0x8410, 0x0027, 0x0008, 0x8001, 0x8410,
+    0x0023, 0x0008, 0x8001, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410, 0x0027, 0x0008, 0x8001, 0x8410,
+    0x002B, 0xFFFF, 0x002C, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0027, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x0021, 0x0008, 0x8001, 0x8410, 0x0021, 0x0008, 0x8002, 0x8410, 0x8410, 0x0027, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x002B, 0xFFFF, 0x002D, 0xFFFF, 0x8001, 0x8410, 0x0028, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x0020, 0x0008, 0x8001, 0x8410, 0x0020, 0x0008, 0x8002, 0x8410, 0x8410, 0x0028, 0x0008,
+    0x8001, 0x8410, 0x002C, 0xFFFF, 0x002E, 0xFFFF, 0x8001, 0x8410, 0x0029, 0x0008, 0x8002, 0x8410,
+    0x8410, 0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x8002, 0x8410, 0x8410, 0x0029, 0x0008,
+    0x8001, 0x8410, 0x002D, 0xFFFF, 0x002E, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002A, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x8002, 0x8410, 0x8410, 0x002A,
+    0x0008, 0x8002, 0x8410, 0x8410, 0x002D, 0xFFFF, 0x002F, 0xFFFF, 0x8001, 0x8410, 0x002B, 0x0008,
+    0x8002, 0x8410, 0x8410, 0x001B, 0x0008, 0x8001, 0x8410, 0x001B, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x002B, 0x0008, 0x8001, 0x8410, 0x002E, 0xFFFF, 0x0030, 0xFFFF, 0x8001, 0x8410, 0x002C, 0x0008,
+    0x0003, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008, 0x0003, 0x8410, 0x002C, 0x0008,
+    0x8001, 0x8410, 0x002F, 0xFFFF, 0x0031, 0xFFFF, 0x8001, 0x8410, 0x002D, 0x0008, 0x0003, 0x8410,
+    0x0016, 0x0008, 0x8001, 0x8410, 0x0016, 0x0008, 0x0003, 0x8410, 0x002D, 0x0008, 0x8001, 0x8410,
+    0x0030, 0xFFFF, 0x0031, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002F, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x0014, 0x0008, 0x8001, 0x8410, 0x0014, 0x0008, 0x8002, 0x8410, 0x8410, 0x002F, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x0030, 0xFFFF, 0x0032, 0xFFFF, 0x8001, 0x8410, 0x0031, 0x0008, 0x0003, 0x8410,
+    0x0011, 0x0008, 0x8001, 0x8410, 0x0011, 0x0008, 0x0003, 0x8410, 0x0031, 0x0008, 0x8001, 0x8410,
+    0x0031, 0xFFFF, 0x0033, 0xFFFF, 0x8001, 0x8410, 0x0033, 0x0008, 0x0004, 0x8410, 0x000D, 0x0008,
+    0x8001, 0x8410, 0x000D, 0x0008, 0x0004, 0x8410, 0x0033, 0x0008, 0x8001, 0x8410, 0x0032, 0xFFFF,
+    0x0034, 0xFFFF, 0x8001, 0x8410, 0x0036, 0x0008, 0x0006, 0x8410, 0x0007, 0x0008, 0x8001, 0x8410,
+    0x0007, 0x0008, 0x0006, 0x8410, 0x0036, 0x0008, 0x8001, 0x8410, 0x0033, 0xFFFF, 0x0035, 0xFFFF,
+    0x8001, 0x8410, 0x003B, 0x0008, 0x000F, 0x8410, 0x003B, 0x0008, 0x8001, 0x8410, 0x0034, 0xFFFF,
+    0x0036, 0xFFFF, 0x8001, 0x8410, 0x0041, 0x0008, 0x8001, 0x8410, 0x0041, 0x0008, 0x8001, 0x8410,
+    0x0035, 0xFFFF, 0x0037, 0xFFFF, 0x8001, 0x8410, 0x0040, 0x0008, 0x8001, 0x8410, 0x0040, 0x0008,
+    0x8001, 0x8410, 0x0036, 0xFFFF, 0x0038, 0xFFFF, 0x8001, 0x8410, 0x003F, 0x0008, 0x8001, 0x8410,
+    0x003F, 0x0008, 0x8001, 0x8410, 0x0037, 0xFFFF, 0x0039, 0xFFFF, 0x8001, 0x8410, 0x003E, 0x0008,
+    0x8001, 0x8410, 0x003E, 0x0008, 0x8001, 0x8410, 0x0038, 0xFFFF, 0x003A, 0xFFFF, 0x8001, 0x8410,
+    0x003D, 0x0008, 0x8001, 0x8410, 0x003D, 0x0008, 0x8001, 0x8410, 0x0039, 0xFFFF, 0x003B, 0xFFFF,
+    0x8001, 0x8410, 0x003C, 0x0008, 0x8001, 0x8410, 0x003C, 0x0008, 0x8001, 0x8410, 0x003A, 0xFFFF,
+    0x003C, 0xFFFF, 0x8001, 0x8410, 0x003B, 0x0008, 0x8001, 0x8410, 0x003B, 0x0008, 0x8001, 0x8410,
+    0x003B, 0xFFFF, 0x003D, 0xFFFF, 0x8001, 0x8410, 0x003A, 0x0008, 0x8001, 0x8410, 0x003A, 0x0008,
+    0x8001, 0x8410, 0x003C, 0xFFFF, 0x003E, 0xFFFF, 0x8001, 0x8410, 0x0039, 0x0008, 0x8001, 0x8410,
+    0x0039, 0x0008, 0x8001, 0x8410, 0x003D, 0xFFFF, 0x003F, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0037,
+    0x0008, 0x8001, 0x8410, 0x0037, 0x0008, 0x8002, 0x8410, 0x8410, 0x003E, 0xFFFF, 0x0040, 0xFFFF,
+    0x8002, 0x8410, 0x8410, 0x0036, 0x0008, 0x8001, 0x8410, 0x0036, 0x0008, 0x8002, 0x8410, 0x8410,
+    0x003F, 0xFFFF, 0x0042, 0xFFFF, 0x8001, 0x8410, 0x0035, 0x0008, 0x8001, 0x8410, 0x0035, 0x0008,
+    0x8001, 0x8410, 0x0041, 0xFFFF, 0x0043, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0033, 0x0008, 0x8001,
+    0x8410, 0x0033, 0x0008, 0x8002, 0x8410, 0x8410, 0x0042, 0xFFFF, 0x0044, 0xFFFF, 0x8002, 0x8410,
+    0x8410, 0x0032, 0x0008, 0x8001, 0x8410, 0x0032, 0x0008, 0x8002, 0x8410, 0x8410, 0x0043, 0xFFFF,
+    0x0046, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0030, 0x0008, 0x8001, 0x8410, 0x0030, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x0045, 0xFFFF, 0x0047, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002F, 0x0008, 0x8001,
+    0x8410, 0x002F, 0x0008, 0x8002, 0x8410, 0x8410, 0x0046, 0xFFFF, 0x0049, 0xFFFF, 0x8002, 0x8410,
+    0x8410, 0x002D, 0x0008, 0x8001, 0x8410, 0x002D, 0x0008, 0x8002, 0x8410, 0x8410, 0x0048, 0xFFFF,
+    0x004B, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002B, 0x0008, 0x8001, 0x8410, 0x002B, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x004A, 0xFFFF, 0x004C, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x002A, 0x0008, 0x8001,
+    0x8410, 0x002A, 0x0008, 0x8002, 0x8410, 0x8410, 0x004B, 0xFFFF, 0x004E, 0xFFFF, 0x8002, 0x8410,
+    0x8410, 0x0028, 0x0008, 0x8001, 0x8410, 0x0028, 0x0008, 0x8002, 0x8410, 0x8410, 0x004D, 0xFFFF,
+    0x0050, 0xFFFF, 0x8002, 0x8410, 0x8410, 0x0026, 0x0008, 0x8001, 0x8410, 0x0026, 0x0008, 0x8002,
+    0x8410, 0x8410, 0x004F, 0xFFFF, 0x0052, 0xFFFF, 0x0003, 0x8410, 0x0023, 0x0008, 0x8001, 0x8410,
+    0x0023, 0x0008, 0x0003, 0x8410, 0x0051, 0xFFFF, 0x0054, 0xFFFF, 0x0003, 0x8410, 0x0021, 0x0008,
+    0x8001, 0x8410, 0x0021, 0x0008, 0x0003, 0x8410, 0x0053, 0xFFFF, 0x0057, 0xFFFF, 0x0003, 0x8410,
+    0x001E, 0x0008, 0x8001, 0x8410, 0x001E, 0x0008, 0x0003, 0x8410, 0x0056, 0xFFFF, 0x0059, 0xFFFF,
+    0x0003, 0x8410, 0x001C, 0x0008, 0x8001, 0x8410, 0x001C, 0x0008, 0x0003, 0x8410, 0x0058, 0xFFFF,
+    0x005C, 0xFFFF, 0x0004, 0x8410, 0x0018, 0x0008, 0x8001, 0x8410, 0x0018, 0x0008, 0x0004, 0x8410,
+    0x005B, 0xFFFF, 0x0060, 0xFFFF, 0x0003, 0x8410, 0x0015, 0x0008, 0x8001, 0x8410, 0x0015, 0x0008,
+    0x0003, 0x8410, 0x005F, 0xFFFF, 0x0063, 0xFFFF, 0x0005, 0x8410, 0x0010, 0x0008, 0x8001, 0x8410,
+    0x0010, 0x0008, 0x0005, 0x8410, 0x0062, 0xFFFF, 0x0068, 0xFFFF, 0x0007, 0x8410, 0x0009, 0x0008,
+    0x8001, 0x8410, 0x0009, 0x0008, 0x0007, 0x8410, 0x0067, 0xFFFF, 0x006F, 0xFFFF, 0x0013, 0x8410,
+    0x006E, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0075, 0xFFFF, 0x000A, 0x0000,
+    0x0071, 0xFFFF, 0x0075, 0xFFFF, 0x000A, 0x0000, 0x0071, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x007B, 0xFFFF, 0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x007B, 0xFFFF, 0x0075, 0xFFFF,
+    0x000A, 0x0000, 0x0071, 0xFFFF, 0x0075, 0xFFFF, 0x000A, 0x0000, 0x0071, 0xFFFF, 0x007F, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF, 0x007F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF,
+    0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF,
+    0x0073, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x006F, 0xFFFF,
+    0x0075, 0xFFFF, 0x000A, 0x0000, 0x0071, 0xFFFF, 0x0075, 0xFFFF, 0x000A, 0x0000, 0x0071, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+};
+
+static const uint16_t bg_sky_rows[320] = {
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0012, 0x0014, 0x001A,
+    0x0020, 0x0026, 0x002C, 0x0032, 0x0038, 0x003E, 0x0044, 0x0053, 0x0062, 0x007B, 0x0094, 0x00AF,
+    0x00CA, 0x00E3, 0x00FC, 0x0114, 0x012C, 0x0159, 0x0186, 0x01A0, 0x01BA, 0x01C0, 0x01C6, 0x01CC,
+    0x01D2, 0x01D8, 0x01DE, 0x01E4, 0x01EA, 0x01EC, 0x01EE, 0x01FA, 0x0206, 0x0211, 0x021C, 0x022C,
+    0x023C, 0x024D, 0x025E, 0x026E, 0x027E, 0x0289, 0x0294, 0x02A0, 0x02AC, 0x02AE, 0x02B0, 0x02B2,
+    0x02B4, 0x02B6, 0x02B8, 0x02BE, 0x02CC, 0x02DA, 0x02E8, 0x02F6, 0x0304, 0x0312, 0x0320, 0x032E,
+    0x033E, 0x034E, 0x035E, 0x036E, 0x037E, 0x038E, 0x039E, 0x03AE, 0x03BE, 0x03CC, 0x03DC, 0x03EC,
+    0x03FA, 0x0408, 0x0416, 0x0424, 0x0432, 0x0440, 0x044E, 0x045C, 0x046A, 0x0478, 0x048E, 0x04A4,
+    0x04BA, 0x04D4, 0x04EA, 0x0500, 0x0518, 0x0532, 0x054A, 0x0562, 0x057C, 0x0592, 0x05AA, 0x05C2,
+    0x05DA, 0x05F2, 0x0608, 0x061E, 0x0634, 0x064A, 0x0662, 0x067A, 0x0690, 0x06A8, 0x06BE, 0x06D6,
+    0x06EC, 0x0702, 0x071A, 0x0730, 0x0750, 0x076E, 0x078C, 0x07AC, 0x07CE, 0x07EC, 0x080C, 0x082C,
+    0x084C, 0x086C, 0x088A, 0x08A8, 0x08C6, 0x08E4, 0x0902, 0x0922, 0x0940, 0x0960, 0x097E, 0x099C,
+    0x09BA, 0x09E6, 0x0A12, 0x0A3F, 0x0A6C, 0x0A99, 0x0AC6, 0x0AF7, 0x0B28, 0x0B44, 0x0B78, 0x0BA3,
+    0x0BCE, 0x0BFA, 0x0C26, 0x0C44, 0x0C62, 0x0C80, 0x0C9E, 0x0CBC, 0x0CDA, 0x0CFA, 0x0D18, 0x0D38,
+    0x0D56, 0x0D74, 0x0D92, 0x0DB0, 0x0DCE, 0x0DEE, 0x0E0E, 0x0E2E, 0x0E4E, 0x0E6C, 0x0E8E, 0x0EAE,
+    0x0ECC, 0x0EEA, 0x0F0A, 0x0F20, 0x0F38, 0x0F4E, 0x0F64, 0x0F7C, 0x0F92, 0x0FAA, 0x0FC0, 0x0FD8,
+    0x0FF0, 0x1006, 0x101C, 0x1032, 0x1048, 0x1060, 0x1078, 0x1090, 0x10A8, 0x10BE, 0x10D8, 0x10F0,
+    0x1108, 0x1122, 0x113A, 0x1150, 0x1166, 0x1180, 0x1196, 0x11AC, 0x11C2, 0x11D0, 0x11DE, 0x11EC,
+    0x11FA, 0x1208, 0x1216, 0x1224, 0x1232, 0x1240, 0x124E, 0x125E, 0x126E, 0x127C, 0x128C, 0x129C,
+    0x12AC, 0x12BC, 0x12CC, 0x12DC, 0x12EC, 0x12FC, 0x130C, 0x131A, 0x1328, 0x1336, 0x1344, 0x1352,
+    0x1360, 0x136E, 0x137C, 0x1382, 0x1384, 0x1386, 0x1388, 0x138E, 0x1394, 0x13A0, 0x13AC, 0x13B3,
+    0x13BA, 0x13C0, 0x13C6, 0x13CD, 0x13D4, 0x13E0, 0x13EC, 0x13F2, 0x13F8, 0x13FA, 0x13FC, 0x13FE,
+    0x1400, 0x1402, 0x1404, 0x1406, 0x1408, 0x140A, 0x140C, 0x140E, 0x1410, 0x1412, 0x1414, 0x1416,
+    0x1418, 0x141A, 0x141C, 0x141E, 0x1420, 0x1422, 0x1424, 0x1426, 0x1428, 0x142A, 0x142C, 0x142E,
+    0x1430, 0x1432, 0x1434, 0x1436, 0x1438, 0x143A, 0x143C, 0x143E, 0x1440, 0x1442, 0x1444, 0x1446,
+    0x1448, 0x144A, 0x144C, 0x144E, 0x1450, 0x1452, 0x1454, 0x1456, 0x1458, 0x145A, 0x145C, 0x145E,
+    0x1460, 0x1462, 0x1464, 0x1466, 0x1468, 0x146A, 0x146C, 0x146E,
+};
+
+const bg_image_t bg_sky = { 240, 320, bg_sky_rows, bg_sky_data };
+
+// bg_trip: 2511 words for 76800 pixels
+static const uint16_t bg_trip_data[2511] = {
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x8010,
+    0x000E, 0xFFFF, 0x0018, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x00AA, 0x8010, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000A, 0x8010, 0x000E, 0xFFFF, 0x0018, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x00AA, 0x8010,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0040, 0x8010, 0x0004,
+    0xFFFF, 0x0086, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF,
+    0x0040, 0x8010, 0x0004, 0xFFFF, 0x0086, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010,
+    0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x8004, 0xFFFF, 0xFFFF, 0x8010, 0x8010, 0x0008, 0xFFFF,
+    0x0009, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x8010, 0x000C, 0xFFFF, 0x0009, 0x8010, 0x0004,
+    0xFFFF, 0x0086, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF,
+    0x0009, 0x8010, 0x8004, 0xFFFF, 0xFFFF, 0x8010, 0x8010, 0x0008, 0xFFFF, 0x0009, 0x8010, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0x8010, 0x000C, 0xFFFF, 0x0009, 0x8010, 0x0004, 0xFFFF, 0x0086, 0x8010,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x0004,
+    0xFFFF, 0x0008, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000B,
+    0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0091, 0x8010, 0x000A,
+    0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x0004, 0xFFFF,
+    0x0008, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x8010,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0091, 0x8010, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x8002, 0xFFFF, 0xFFFF,
+    0x0013, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x8010,
+    0x8002, 0xFFFF, 0xFFFF, 0x0091, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002,
+    0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x8010, 0x8002, 0xFFFF, 0xFFFF,
+    0x000B, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0091, 0x8010,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x8002,
+    0xFFFF, 0xFFFF, 0x0013, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x8010, 0x000C, 0xFFFF, 0x0009,
+    0x8010, 0x0004, 0xFFFF, 0x0086, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002,
+    0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x8010, 0x8002, 0xFFFF, 0xFFFF,
+    0x000B, 0x8010, 0x000C, 0xFFFF, 0x0009, 0x8010, 0x0004, 0xFFFF, 0x0086, 0x8010, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0009, 0x8010, 0x8002, 0xFFFF, 0xFFFF,
+    0x0013, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x8010,
+    0x0004, 0xFFFF, 0x0086, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x8010, 0x8002, 0xFFFF,
+    0xFFFF, 0x0009, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x000B,
+    0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x8010, 0x0004, 0xFFFF, 0x0086, 0x8010, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x003D, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x009D, 0x8010, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x003D, 0x8010, 0x8002, 0xFFFF, 0xFFFF, 0x009D, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x00DC, 0x8010, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x8010, 0x000A, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0014, 0xFFFF, 0x0006, 0x630C, 0x0005, 0xFFFF,
+    0x8001, 0x630C, 0x0011, 0xFFFF, 0x8001, 0x630C, 0x00BE, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x0016, 0xFFFF, 0x8001, 0x630C, 0x00BE, 0xFFFF, 0x0014, 0xFFFF,
+    0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C, 0x0007, 0xFFFF,
+    0x0006, 0x630C, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x630C, 0x0005, 0xFFFF, 0x0005, 0x630C, 0x0003,
+    0xFFFF, 0x8002, 0x630C, 0xFFFF, 0x0004, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF,
+    0x0005, 0x630C, 0x0097, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C,
+    0x0004, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF, 0x8001, 0x630C, 0x000A, 0xFFFF, 0x8001, 0x630C,
+    0x000C, 0xFFFF, 0x8005, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x630C, 0x0004, 0xFFFF, 0x8004, 0x630C,
+    0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF,
+    0x8001, 0x630C, 0x0096, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C,
+    0x0004, 0xFFFF, 0x8001, 0x630C, 0x0007, 0xFFFF, 0x0005, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C,
+    0x0007, 0xFFFF, 0x0006, 0x630C, 0x8003, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C,
+    0xFFFF, 0xFFFF, 0x630C, 0x0008, 0xFFFF, 0x0007, 0x630C, 0x0096, 0xFFFF, 0x0014, 0xFFFF, 0x8001,
+    0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C, 0x000C, 0xFFFF, 0x8001,
+    0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF,
+    0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x009C, 0xFFFF, 0x0014,
+    0xFFFF, 0x0006, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF, 0x0006, 0x630C, 0x0006,
+    0xFFFF, 0x0003, 0x630C, 0x0004, 0xFFFF, 0x0006, 0x630C, 0x8003, 0xFFFF, 0xFFFF, 0x630C, 0x0005,
+    0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0097,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005,
+    0xFFFF, 0x8001, 0x630C, 0x0016, 0xFFFF, 0x8001, 0x630C, 0x0023, 0xFFFF, 0x8001, 0x630C, 0x0008,
+    0xFFFF, 0x8001, 0x630C, 0x0091, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x630C, 0x630C, 0x0003, 0xFFFF,
+    0x8002, 0x630C, 0x630C, 0x003A, 0xFFFF, 0x8001, 0x630C, 0x009A, 0xFFFF, 0x0014, 0xFFFF, 0x8007,
+    0x630C, 0xFFFF, 0x630C, 0xFFFF, 0x630C, 0xFFFF, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x0003,
+    0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C, 0x0006,
+    0xFFFF, 0x8002, 0x630C, 0xFFFF, 0x0004, 0x630C, 0x0004, 0xFFFF, 0x0006, 0x630C, 0x000B, 0xFFFF,
+    0x0005, 0x630C, 0x0006, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF, 0x0003, 0x630C, 0x8003, 0xFFFF,
+    0x630C, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x007C, 0xFFFF, 0x0014, 0xFFFF, 0x800A, 0x630C,
+    0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C,
+    0x0006, 0xFFFF, 0x8002, 0x630C, 0x630C, 0x0004, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x000D, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C,
+    0x0006, 0xFFFF, 0x800A, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF,
+    0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x007B, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005,
+    0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF,
+    0x8001, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF,
+    0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8001,
+    0x630C, 0x000D, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF, 0x8009,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x0007, 0x630C, 0x007B,
+    0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x0004, 0xFFFF, 0x8003, 0x630C, 0xFFFF, 0x630C, 0x0006, 0xFFFF,
+    0x8001, 0x630C, 0x0006, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF,
+    0x0006, 0x630C, 0x000D, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0004, 0xFFFF,
+    0x8001, 0x630C, 0x0006, 0xFFFF, 0x800A, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0xFFFF, 0xFFFF, 0x630C, 0x0081, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001,
+    0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x0006, 0xFFFF, 0x8001, 0x630C, 0x0007, 0xFFFF, 0x8001,
+    0x630C, 0x0006, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8001,
+    0x630C, 0x000E, 0xFFFF, 0x0003, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF, 0x8007,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x007C,
+    0xFFFF, 0x0042, 0xFFFF, 0x0005, 0x630C, 0x00A9, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0016,
+    0xFFFF, 0x0003, 0x630C, 0x006D, 0xFFFF, 0x8001, 0x630C, 0x0069, 0xFFFF, 0x0015, 0xFFFF, 0x8001,
+    0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x006C, 0xFFFF, 0x8001, 0x630C, 0x0069, 0xFFFF, 0x0014,
+    0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF,
+    0x8001, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x0003, 0xFFFF, 0x8002, 0x630C, 0xFFFF, 0x0004,
+    0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF, 0x0006, 0x630C, 0x0003, 0xFFFF, 0x0005,
+    0x630C, 0x000D, 0xFFFF, 0x0006, 0x630C, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x630C, 0x0004, 0xFFFF,
+    0x0005, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF, 0x0006, 0x630C, 0x0069, 0xFFFF,
+    0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005,
+    0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8005, 0x630C, 0xFFFF, 0xFFFF,
+    0x630C, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF,
+    0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C,
+    0x000B, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C,
+    0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF,
+    0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0069, 0xFFFF, 0x0014,
+    0xFFFF, 0x0007, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0003,
+    0xFFFF, 0x0007, 0x630C, 0x8003, 0xFFFF, 0xFFFF, 0x630C, 0x0009, 0xFFFF, 0x0006, 0x630C, 0x8003,
+    0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8003, 0x630C, 0xFFFF, 0xFFFF, 0x0007, 0x630C, 0x000C,
+    0xFFFF, 0x0005, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8003, 0x630C, 0xFFFF,
+    0xFFFF, 0x0007, 0x630C, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x630C, 0x8003, 0xFFFF, 0xFFFF, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x0069, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF,
+    0x8001, 0x630C, 0x0004, 0xFFFF, 0x8003, 0x630C, 0xFFFF, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C,
+    0x0008, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C,
+    0x0003, 0xFFFF, 0x0006, 0x630C, 0x8003, 0xFFFF, 0xFFFF, 0x630C, 0x0017, 0xFFFF, 0x8003, 0x630C,
+    0xFFFF, 0xFFFF, 0x0006, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C,
+    0x0008, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0069, 0xFFFF, 0x0014, 0xFFFF,
+    0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF,
+    0x0005, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0009, 0xFFFF, 0x0006, 0x630C, 0x0008, 0xFFFF,
+    0x8001, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x000C, 0xFFFF, 0x0006, 0x630C, 0x0003, 0xFFFF,
+    0x8001, 0x630C, 0x0009, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF,
+    0x0006, 0x630C, 0x0069, 0xFFFF, 0x0042, 0xFFFF, 0x0005, 0x630C, 0x001E, 0xFFFF, 0x8001, 0x630C,
+    0x008A, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF,
+    0x8001, 0x630C, 0x0047, 0xFFFF, 0x8001, 0x630C, 0x008D, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x630C,
+    0x630C, 0x0003, 0xFFFF, 0x8002, 0x630C, 0x630C, 0x0047, 0xFFFF, 0x8001, 0x630C, 0x008D, 0xFFFF,
+    0x0014, 0xFFFF, 0x8007, 0x630C, 0xFFFF, 0x630C, 0xFFFF, 0x630C, 0xFFFF, 0x630C, 0x0003, 0xFFFF,
+    0x0005, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x000C, 0xFFFF,
+    0x0006, 0x630C, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0004,
+    0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF, 0x0006, 0x630C, 0x008D, 0xFFFF, 0x0014, 0xFFFF, 0x8007,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C, 0x0003,
+    0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x000C, 0xFFFF, 0x8001, 0x630C, 0x0008,
+    0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF,
+    0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x008D, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF,
+    0x8001, 0x630C, 0x0003, 0xFFFF, 0x0006, 0x630C, 0x0004, 0xFFFF, 0x8003, 0x630C, 0xFFFF, 0x630C,
+    0x000E, 0xFFFF, 0x0005, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8003, 0x630C,
+    0xFFFF, 0xFFFF, 0x0007, 0x630C, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x630C, 0x8003, 0xFFFF, 0xFFFF,
+    0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x008D, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005,
+    0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF,
+    0x8001, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0012, 0xFFFF, 0x8003, 0x630C, 0xFFFF, 0xFFFF,
+    0x0006, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF,
+    0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x008D, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x0006, 0x630C, 0x8003, 0xFFFF, 0xFFFF, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x000B, 0xFFFF, 0x0006, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C,
+    0x0009, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0004, 0xFFFF, 0x0006, 0x630C,
+    0x008D, 0xFFFF, 0x0041, 0xFFFF, 0x8001, 0x630C, 0x00AE, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x0015, 0xFFFF, 0x0005, 0x630C, 0x0009, 0xFFFF, 0x8001, 0x630C, 0x001F, 0xFFFF, 0x8001, 0x630C,
+    0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0008, 0xFFFF,
+    0x8001, 0x630C, 0x001F, 0xFFFF, 0x8001, 0x630C, 0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C,
+    0x0005, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x0006, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C,
+    0x0003, 0xFFFF, 0x0003, 0x630C, 0x8003, 0xFFFF, 0x630C, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C,
+    0x0003, 0xFFFF, 0x0005, 0x630C, 0x0005, 0xFFFF, 0x0005, 0x630C, 0x0003, 0xFFFF, 0x8002, 0x630C,
+    0xFFFF, 0x0004, 0x630C, 0x0097, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005,
+    0xFFFF, 0x800D, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8001, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C, 0x0006,
+    0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8005, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x630C, 0x0004,
+    0xFFFF, 0x8001, 0x630C, 0x0096, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF, 0x8004,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005,
+    0xFFFF, 0x800C, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0xFFFF, 0xFFFF, 0x0007, 0x630C, 0x0004, 0xFFFF, 0x8001, 0x630C, 0x0006, 0xFFFF, 0x0007, 0x630C,
+    0x8003, 0xFFFF, 0xFFFF, 0x630C, 0x009C, 0xFFFF, 0x0014, 0xFFFF, 0x8001, 0x630C, 0x0005, 0xFFFF,
+    0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0005, 0xFFFF, 0x8004, 0x630C, 0xFFFF, 0xFFFF, 0x630C,
+    0x0005, 0xFFFF, 0x800D, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x000A, 0xFFFF, 0x8001, 0x630C, 0x0003, 0xFFFF, 0x8004, 0x630C,
+    0xFFFF, 0xFFFF, 0x630C, 0x0008, 0xFFFF, 0x8001, 0x630C, 0x009C, 0xFFFF, 0x0015, 0xFFFF, 0x0005,
+    0x630C, 0x0004, 0xFFFF, 0x0006, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x0003, 0xFFFF, 0x8007,
+    0x630C, 0xFFFF, 0xFFFF, 0x630C, 0xFFFF, 0xFFFF, 0x630C, 0x0003, 0xFFFF, 0x0005, 0x630C, 0x0006,
+    0xFFFF, 0x0003, 0x630C, 0x0004, 0xFFFF, 0x0005, 0x630C, 0x0003, 0xFFFF, 0x8001, 0x630C, 0x009C,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0,
+    0xFFFF, 0x00F0, 0xFFFF,
+};
+
+static const uint16_t bg_trip_rows[320] = {
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0012, 0x0014, 0x001A,
+    0x0020, 0x0026, 0x002C, 0x0032, 0x0038, 0x003E, 0x0044, 0x0053, 0x0062, 0x0071, 0x0080, 0x00A1,
+    0x00C2, 0x00E5, 0x0108, 0x0127, 0x0146, 0x0163, 0x0180, 0x019E, 0x01BC, 0x01C7, 0x01D2, 0x01D8,
+    0x01DE, 0x01E4, 0x01EA, 0x01F0, 0x01F6, 0x01F8, 0x01FA, 0x01FC, 0x01FE, 0x0200, 0x0202, 0x0204,
+    0x0206, 0x0208, 0x020A, 0x0218, 0x0226, 0x0250, 0x0280, 0x02A9, 0x02DB, 0x0301, 0x0303, 0x0305,
+    0x0307, 0x0309, 0x030B, 0x030D, 0x030F, 0x0311, 0x0313, 0x0315, 0x0317, 0x0319, 0x031B, 0x031D,
+    0x031F, 0x0321, 0x0323, 0x0325, 0x0327, 0x0329, 0x032B, 0x032D, 0x032F, 0x0331, 0x0333, 0x0335,
+    0x0337, 0x0339, 0x033B, 0x033D, 0x033F, 0x0341, 0x0343, 0x0359, 0x0369, 0x03A4, 0x03EB, 0x042D,
+    0x046D, 0x04A5, 0x04AB, 0x04AD, 0x04AF, 0x04B1, 0x04B3, 0x04B5, 0x04B7, 0x04B9, 0x04BB, 0x04BD,
+    0x04BF, 0x04C1, 0x04C3, 0x04C5, 0x04C7, 0x04C9, 0x04CB, 0x04CD, 0x04CF, 0x04D1, 0x04D3, 0x04D5,
+    0x04D7, 0x04D9, 0x04DB, 0x04DD, 0x04DF, 0x04E1, 0x04E3, 0x04E5, 0x04E7, 0x04E9, 0x04EB, 0x04F5,
+    0x0503, 0x0540, 0x0593, 0x05D6, 0x0616, 0x064C, 0x0656, 0x0658, 0x065A, 0x065C, 0x065E, 0x0660,
+    0x0662, 0x0664, 0x0666, 0x0668, 0x066A, 0x066C, 0x066E, 0x0670, 0x0672, 0x0674, 0x0676, 0x0678,
+    0x067A, 0x067C, 0x067E, 0x0680, 0x0682, 0x0684, 0x0686, 0x0688, 0x068A, 0x068C, 0x068E, 0x0690,
+    0x0692, 0x0694, 0x0696, 0x06A4, 0x06B4, 0x06E1, 0x071A, 0x074B, 0x077C, 0x07A6, 0x07AC, 0x07AE,
+    0x07B0, 0x07B2, 0x07B4, 0x07B6, 0x07B8, 0x07BA, 0x07BC, 0x07BE, 0x07C0, 0x07C2, 0x07C4, 0x07C6,
+    0x07C8, 0x07CA, 0x07CC, 0x07CE, 0x07D0, 0x07D2, 0x07D4, 0x07D6, 0x07D8, 0x07DA, 0x07DC, 0x07DE,
+    0x07E0, 0x07E2, 0x07E4, 0x07E6, 0x07E8, 0x07EA, 0x07EC, 0x07FA, 0x080C, 0x0839, 0x0875, 0x08A6,
+    0x08D9, 0x0901, 0x0903, 0x0905, 0x0907, 0x0909, 0x090B, 0x090D, 0x090F, 0x0911, 0x0913, 0x0915,
+    0x0917, 0x0919, 0x091B, 0x091D, 0x091F, 0x0921, 0x0923, 0x0925, 0x0927, 0x0929, 0x092B, 0x092D,
+    0x092F, 0x0931, 0x0933, 0x0935, 0x0937, 0x0939, 0x093B, 0x093D, 0x093F, 0x0941, 0x0943, 0x0945,
+    0x0947, 0x0949, 0x094B, 0x094D, 0x094F, 0x0951, 0x0953, 0x0955, 0x0957, 0x0959, 0x095B, 0x095D,
+    0x095F, 0x0961, 0x0963, 0x0965, 0x0967, 0x0969, 0x096B, 0x096D, 0x096F, 0x0971, 0x0973, 0x0975,
+    0x0977, 0x0979, 0x097B, 0x097D, 0x097F, 0x0981, 0x0983, 0x0985, 0x0987, 0x0989, 0x098B, 0x098D,
+    0x098F, 0x0991, 0x0993, 0x0995, 0x0997, 0x0999, 0x099B, 0x099D, 0x099F, 0x09A1, 0x09A3, 0x09A5,
+    0x09A7, 0x09A9, 0x09AB, 0x09AD, 0x09AF, 0x09B1, 0x09B3, 0x09B5, 0x09B7, 0x09B9, 0x09BB, 0x09BD,
+    0x09BF, 0x09C1, 0x09C3, 0x09C5, 0x09C7, 0x09C9, 0x09CB, 0x09CD,
+};
+
+const bg_image_t bg_trip = { 240, 320, bg_trip_rows, bg_trip_data };
+
+// bg_all: 3350 words for 76800 pixels
+static const uint16_t bg_all_data[3350] = {
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F,
+    0x000A, 0xFFFF, 0x0044, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000C, 0x001F, 0x000A, 0xFFFF, 0x0044, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002,
+    0xFFFF, 0xFFFF, 0x0042, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075,
+    0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x0042, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF,
+    0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F,
+    0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007,
+    0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F,
+    0x000A, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F,
+    0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F, 0x000A, 0xFFFF,
+    0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F,
+    0x000A, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x0016, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F,
+    0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x000E, 0xFFFF, 0x0003, 0x001F, 0x000E, 0xFFFF, 0x0003,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0080, 0x001F, 0x000A,
+    0xFFFF, 0x000A, 0xFFFF, 0x0016, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x000E, 0xFFFF, 0x0003, 0x001F,
+    0x000E, 0xFFFF, 0x0003, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0080, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x001F, 0x000C, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0003, 0x001F, 0x000C, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x8002,
+    0xFFFF, 0xFFFF, 0x000F, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x001F, 0x8002, 0xFFFF, 0xFFFF,
+    0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F,
+    0x000A, 0xFFFF, 0x0005, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0x001F, 0x000A, 0xFFFF, 0x0007,
+    0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000C, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075,
+    0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000C, 0x001F, 0x000A, 0xFFFF, 0x0005, 0x001F, 0x8002,
+    0xFFFF, 0xFFFF, 0x0011, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F, 0x000A, 0xFFFF, 0x0007, 0x001F,
+    0x000C, 0xFFFF, 0x0007, 0x001F, 0x0004, 0xFFFF, 0x0075, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x001B, 0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x00BF, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x001B,
+    0x001F, 0x8002, 0xFFFF, 0xFFFF, 0x00BF, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x001F, 0x000A, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x002C, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF, 0x00A0, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x002C, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x001B, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x002A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x002A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF,
+    0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF,
+    0x0006, 0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0007, 0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0011, 0xFFFF, 0x00A0,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x0006,
+    0x0000, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007,
+    0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0011, 0xFFFF, 0x00A0, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0009, 0xFFFF, 0x0004,
+    0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x0008, 0x0000,
+    0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000B, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x0008, 0x0000,
+    0x0009, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000B, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000D, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x00A0, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0008, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0005, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0004, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x0046, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0077, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x0046, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0077, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0046, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x0042, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0046, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0042, 0xF800,
+    0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0011, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A,
+    0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0xF800,
+    0x000A, 0xFFFF, 0x0005, 0xF800, 0x8004, 0xFFFF, 0xFFFF, 0xF800, 0xF800, 0x0008, 0xFFFF, 0x0009,
+    0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x0011, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800,
+    0x000A, 0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000D,
+    0xF800, 0x000A, 0xFFFF, 0x0005, 0xF800, 0x8004, 0xFFFF, 0xFFFF, 0xF800, 0xF800, 0x0008, 0xFFFF,
+    0x0009, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x0003, 0xF800, 0x0004, 0xFFFF, 0x0008, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A,
+    0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x0004, 0xFFFF, 0x0008, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0xF800, 0x000C, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0011, 0xF800, 0x000C, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x004D, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000F, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x0006, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000F, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF,
+    0x000A, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0006, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x0007, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF,
+    0x000A, 0xF800, 0x000E, 0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A, 0xFFFF,
+    0x0007, 0xF800, 0x000C, 0xFFFF, 0x0009, 0xF800, 0x0006, 0xFFFF, 0x0009, 0xF800, 0x8002, 0xFFFF,
+    0xFFFF, 0x000D, 0xF800, 0x000A, 0xFFFF, 0x0005, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0xF800,
+    0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x000A, 0xF800, 0x000E, 0xFFFF, 0x0005, 0xF800, 0x000A, 0xFFFF, 0x0007, 0xF800, 0x000A,
+    0xFFFF, 0x0007, 0xF800, 0x000C, 0xFFFF, 0x0009, 0xF800, 0x0006, 0xFFFF, 0x0009, 0xF800, 0x8002,
+    0xFFFF, 0xFFFF, 0x000D, 0xF800, 0x000A, 0xFFFF, 0x0005, 0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x000A,
+    0xF800, 0x8002, 0xFFFF, 0xFFFF, 0x0007, 0xF800, 0x0004, 0xFFFF, 0x0042, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0xF800, 0x000A, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF,
+    0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0024, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF,
+    0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A,
+    0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x000B, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000,
+    0x000B, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x001B, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000C,
+    0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0011, 0xFFFF, 0x000C, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00B4, 0xFFFF,
+    0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0006, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000, 0x0005, 0xFFFF, 0x000C, 0x0000, 0x0009, 0xFFFF,
+    0x0006, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000,
+    0x0005, 0xFFFF, 0x000C, 0x0000, 0x0009, 0xFFFF, 0x0006, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00DA, 0xFFFF, 0x0014, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x00DA, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0035, 0xFFFF, 0x0004,
+    0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0035, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A, 0x0000, 0x0005,
+    0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0011, 0xFFFF, 0x000A, 0x0000, 0x0005,
+    0xFFFF, 0x8004, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0008, 0x0000, 0x0009, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x0004, 0x0000, 0x0008, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x0004, 0x0000, 0x0008,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F,
+    0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00AC, 0xFFFF, 0x0014, 0xFFFF, 0x8002,
+    0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x00AC, 0xFFFF,
+    0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000,
+    0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000, 0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x8002, 0x0000, 0x0000,
+    0x000F, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0003, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x0005, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x0014, 0xFFFF, 0x000E, 0x0000, 0x0005, 0xFFFF, 0x000A, 0x0000, 0x0005, 0xFFFF,
+    0x8002, 0x0000, 0x0000, 0x000A, 0xFFFF, 0x8002, 0x0000, 0x0000, 0x0007, 0xFFFF, 0x0004, 0x0000,
+    0x00A1, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x0400, 0x000E, 0xFFFF, 0x0007, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x00BB, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x000A, 0x0400, 0x000E, 0xFFFF, 0x0007,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x00BB, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0040, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0040, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400,
+    0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x0006, 0xFFFF, 0x8002, 0x0400, 0x0400, 0x0004, 0xFFFF, 0x0007,
+    0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A,
+    0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B,
+    0x0400, 0x0006, 0xFFFF, 0x8002, 0x0400, 0x0400, 0x0004, 0xFFFF, 0x0007, 0x0400, 0x000A, 0xFFFF,
+    0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0091, 0x0400, 0x000A,
+    0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000A, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0091, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x000E,
+    0xFFFF, 0x0091, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x000E, 0xFFFF,
+    0x0091, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002,
+    0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x0013, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0003,
+    0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0013, 0x0400, 0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400, 0x8002, 0xFFFF, 0xFFFF,
+    0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400, 0x0004, 0xFFFF, 0x0086,
+    0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x0010, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x000D, 0x0400,
+    0x8002, 0xFFFF, 0xFFFF, 0x000B, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF,
+    0xFFFF, 0x0004, 0x0400, 0x8002, 0xFFFF, 0xFFFF, 0x0005, 0x0400, 0x000A, 0xFFFF, 0x0009, 0x0400,
+    0x0004, 0xFFFF, 0x0086, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF,
+    0x000A, 0xFFFF, 0x00DC, 0x0400, 0x000A, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF,
+    0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000,
+    0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF,
+    0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF,
+    0x0004, 0x0000, 0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000,
+    0x007F, 0xFFFF, 0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF,
+    0x003B, 0xFFFF, 0x0004, 0x0000, 0x002E, 0xFFFF, 0x0004, 0x0000, 0x007F, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF, 0x00F0, 0xFFFF,
+    0x00F0, 0xFFFF,
+};
+
+static const uint16_t bg_all_rows[320] = {
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0012, 0x0014, 0x001A,
+    0x0020, 0x0026, 0x002C, 0x0032, 0x0038, 0x003E, 0x0044, 0x0053, 0x0062, 0x007B, 0x0094, 0x00B3,
+    0x00D2, 0x0104, 0x0136, 0x015D, 0x0184, 0x01B0, 0x01DC, 0x01FB, 0x021A, 0x0225, 0x0230, 0x0236,
+    0x023C, 0x0242, 0x0248, 0x024E, 0x0254, 0x0256, 0x0258, 0x025A, 0x025C, 0x025E, 0x0260, 0x0262,
+    0x0264, 0x0266, 0x0268, 0x0279, 0x028A, 0x029B, 0x02AC, 0x02CF, 0x02F2, 0x031B, 0x0344, 0x0368,
+    0x038C, 0x03B6, 0x03E0, 0x040A, 0x0434, 0x0436, 0x0438, 0x043A, 0x043C, 0x043E, 0x0440, 0x0442,
+    0x0444, 0x0446, 0x0448, 0x044A, 0x044C, 0x044E, 0x0450, 0x0452, 0x0454, 0x0456, 0x0458, 0x045A,
+    0x045C, 0x045E, 0x0460, 0x0462, 0x0464, 0x0466, 0x0468, 0x046A, 0x046C, 0x046E, 0x0470, 0x0472,
+    0x0474, 0x0476, 0x0478, 0x047A, 0x047C, 0x0482, 0x0488, 0x048E, 0x0494, 0x049A, 0x04A0, 0x04A6,
+    0x04AC, 0x04C1, 0x04D6, 0x04EA, 0x04FE, 0x052F, 0x0560, 0x05A1, 0x05E2, 0x061E, 0x065A, 0x06AA,
+    0x06FA, 0x072B, 0x075C, 0x0762, 0x0768, 0x076E, 0x0774, 0x077A, 0x0780, 0x0786, 0x078C, 0x078E,
+    0x0790, 0x0792, 0x0794, 0x0796, 0x0798, 0x079A, 0x079C, 0x079E, 0x07A0, 0x07AC, 0x07B8, 0x07C8,
+    0x07D8, 0x07EB, 0x07FE, 0x080F, 0x0820, 0x0830, 0x0840, 0x085F, 0x087E, 0x0890, 0x08A2, 0x08A4,
+    0x08A6, 0x08A8, 0x08AA, 0x08AC, 0x08AE, 0x08B5, 0x08BC, 0x08C7, 0x08D2, 0x08EA, 0x0902, 0x091C,
+    0x0936, 0x0951, 0x096C, 0x098B, 0x09AA, 0x09C2, 0x09DA, 0x09DC, 0x09DE, 0x09E0, 0x09E2, 0x09E4,
+    0x09E6, 0x09E8, 0x09EA, 0x09EC, 0x09EE, 0x09F0, 0x09F2, 0x09F4, 0x09F6, 0x09F8, 0x09FA, 0x09FC,
+    0x09FE, 0x0A00, 0x0A02, 0x0A04, 0x0A06, 0x0A08, 0x0A0A, 0x0A0C, 0x0A0E, 0x0A10, 0x0A12, 0x0A14,
+    0x0A16, 0x0A18, 0x0A1A, 0x0A1C, 0x0A1E, 0x0A20, 0x0A22, 0x0A28, 0x0A2E, 0x0A34, 0x0A3A, 0x0A40,
+    0x0A46, 0x0A4C, 0x0A52, 0x0A61, 0x0A70, 0x0A7F, 0x0A8E, 0x0AAF, 0x0AD0, 0x0AF9, 0x0B22, 0x0B45,
+    0x0B68, 0x0B90, 0x0BB8, 0x0BDF, 0x0C06, 0x0C0C, 0x0C12, 0x0C18, 0x0C1E, 0x0C24, 0x0C2A, 0x0C30,
+    0x0C36, 0x0C38, 0x0C3A, 0x0C3C, 0x0C3E, 0x0C40, 0x0C42, 0x0C44, 0x0C46, 0x0C48, 0x0C4A, 0x0C4C,
+    0x0C4E, 0x0C58, 0x0C62, 0x0C6C, 0x0C76, 0x0C78, 0x0C7A, 0x0C7C, 0x0C7E, 0x0C88, 0x0C92, 0x0C9C,
+    0x0CA6, 0x0CA8, 0x0CAA, 0x0CAC, 0x0CAE, 0x0CB0, 0x0CB2, 0x0CB4, 0x0CB6, 0x0CB8, 0x0CBA, 0x0CBC,
+    0x0CBE, 0x0CC0, 0x0CC2, 0x0CC4, 0x0CC6, 0x0CC8, 0x0CCA, 0x0CCC, 0x0CCE, 0x0CD0, 0x0CD2, 0x0CD4,
+    0x0CD6, 0x0CD8, 0x0CDA, 0x0CDC, 0x0CDE, 0x0CE0, 0x0CE2, 0x0CE4, 0x0CE6, 0x0CE8, 0x0CEA, 0x0CEC,
+    0x0CEE, 0x0CF0, 0x0CF2, 0x0CF4, 0x0CF6, 0x0CF8, 0x0CFA, 0x0CFC, 0x0CFE, 0x0D00, 0x0D02, 0x0D04,
+    0x0D06, 0x0D08, 0x0D0A, 0x0D0C, 0x0D0E, 0x0D10, 0x0D12, 0x0D14,
+};
+
+const bg_image_t bg_all = { 240, 320, bg_all_rows, bg_all_data };
+
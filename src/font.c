@@ -1,3 +1,4 @@
+#include <stddef.h>
 #include "font.h"
 
 // Complete 8x8 font - covers all printable ASCII characters (32-126)
@@ -15,9 +16,9 @@
 //   ASCII 123-126: { | } ~                          (4 symbols)
 // Total: 95 printable ASCII characters - COMPLETE
 //
-// The get_char_data() function automatically handles any ASCII character
-// in the range 32-126 without requiring code updates.
-const unsigned char font_8x8[95][8] = {
+// font_small, font_medium and font_large below draw this table at 1x, 2x
+// and 3x; font_glyph handles any character in the range 32-126.
+static const uint8_t font_8x8[95][8] = {
     // ASCII 32: Space
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
     // ASCII 33: !
@@ -210,13 +211,30 @@ const unsigned char font_8x8[95][8] = {
     {0x00, 0x00, 0x62, 0x92, 0x8C, 0x00, 0x00, 0x00},
 };
 
-// Get font data for a character
-// Maps ASCII character to font array index (ASCII - 32)
-const unsigned char* get_char_data(char c) {
-    // Only handle printable ASCII (32-126)
-    if (c >= 32 && c <= 126) {
-        return font_8x8[c - 32];
+const font_t font_small = { &font_8x8[0][0], 32, 95, 8, 1, 1, 8, 8, 9 };
+const font_t font_medium = { &font_8x8[0][0], 32, 95, 8, 1, 2, 16, 16, 17 };
+const font_t font_large = { &font_8x8[0][0], 32, 95, 8, 1, 3, 24, 24, 26 };
+
+// Maps a character to its glyph (character - first)
+const uint8_t* font_glyph(const font_t* font, char c) {
+    uint8_t index = (uint8_t)c - font->first;
+    if ((uint8_t)c < font->first || index >= font->count) return NULL;
+    return font->bitmap + index * font->rows * font->bytes_per_row;
+}
+
+// Expand each source byte with one table lookup and place it below the previous
+uint32_t font_expand_row(const font_t* font, const uint8_t* row) {
+    uint32_t bits = 0;
+    uint8_t shift = 32;
+    for (uint8_t i = 0; i < font->bytes_per_row; i++) {
+        uint32_t expanded;
+        switch (font->scale) {
+            case 1: expanded = row[i]; break;
+            case 2: expanded = font_expand2[row[i]]; break;
+            default: expanded = font_expand3[row[i]]; break;
+        }
+        shift -= 8 * font->scale;
+        bits |= expanded << shift;
     }
-    // Return space for non-printable characters
-    return font_8x8[0];
+    return bits;
 }
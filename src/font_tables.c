@@ -0,0 +1,135 @@
+// Generated by tools/gen_fonts.py from tools/fonts/*.txt. Do not edit;
+// rebuild to regenerate.
+#include "font.h"
+
+// Each source bit repeated 2 and 3 times, MSB first
+const uint16_t font_expand2[256] = {
+    0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F,
+    0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF,
+    0x0300, 0x0303, 0x030C, 0x030F, 0x0330, 0x0333, 0x033C, 0x033F,
+    0x03C0, 0x03C3, 0x03CC, 0x03CF, 0x03F0, 0x03F3, 0x03FC, 0x03FF,
+    0x0C00, 0x0C03, 0x0C0C, 0x0C0F, 0x0C30, 0x0C33, 0x0C3C, 0x0C3F,
+    0x0CC0, 0x0CC3, 0x0CCC, 0x0CCF, 0x0CF0, 0x0CF3, 0x0CFC, 0x0CFF,
+    0x0F00, 0x0F03, 0x0F0C, 0x0F0F, 0x0F30, 0x0F33, 0x0F3C, 0x0F3F,
+    0x0FC0, 0x0FC3, 0x0FCC, 0x0FCF, 0x0FF0, 0x0FF3, 0x0FFC, 0x0FFF,
+    0x3000, 0x3003, 0x300C, 0x300F, 0x3030, 0x3033, 0x303C, 0x303F,
+    0x30C0, 0x30C3, 0x30CC, 0x30CF, 0x30F0, 0x30F3, 0x30FC, 0x30FF,
+    0x3300, 0x3303, 0x330C, 0x330F, 0x3330, 0x3333, 0x333C, 0x333F,
+    0x33C0, 0x33C3, 0x33CC, 0x33CF, 0x33F0, 0x33F3, 0x33FC, 0x33FF,
+    0x3C00, 0x3C03, 0x3C0C, 0x3C0F, 0x3C30, 0x3C33, 0x3C3C, 0x3C3F,
+    0x3CC0, 0x3CC3, 0x3CCC, 0x3CCF, 0x3CF0, 0x3CF3, 0x3CFC, 0x3CFF,
+    0x3F00, 0x3F03, 0x3F0C, 0x3F0F, 0x3F30, 0x3F33, 0x3F3C, 0x3F3F,
+    0x3FC0, 0x3FC3, 0x3FCC, 0x3FCF, 0x3FF0, 0x3FF3, 0x3FFC, 0x3FFF,
+    0xC000, 0xC003, 0xC00C, 0xC00F, 0xC030, 0xC033, 0xC03C, 0xC03F,
+    0xC0C0, 0xC0C3, 0xC0CC, 0xC0CF, 0xC0F0, 0xC0F3, 0xC0FC, 0xC0FF,
+    0xC300, 0xC303, 0xC30C, 0xC30F, 0xC330, 0xC333, 0xC33C, 0xC33F,
+    0xC3C0, 0xC3C3, 0xC3CC, 0xC3CF, 0xC3F0, 0xC3F3, 0xC3FC, 0xC3FF,
+    0xCC00, 0xCC03, 0xCC0C, 0xCC0F, 0xCC30, 0xCC33, 0xCC3C, 0xCC3F,
+    0xCCC0, 0xCCC3, 0xCCCC, 0xCCCF, 0xCCF0, 0xCCF3, 0xCCFC, 0xCCFF,
+    0xCF00, 0xCF03, 0xCF0C, 0xCF0F, 0xCF30, 0xCF33, 0xCF3C, 0xCF3F,
+    0xCFC0, 0xCFC3, 0xCFCC, 0xCFCF, 0xCFF0, 0xCFF3, 0xCFFC, 0xCFFF,
+    0xF000, 0xF003, 0xF00C, 0xF00F, 0xF030, 0xF033, 0xF03C, 0xF03F,
+    0xF0C0, 0xF0C3, 0xF0CC, 0xF0CF, 0xF0F0, 0xF0F3, 0xF0FC, 0xF0FF,
+    0xF300, 0xF303, 0xF30C, 0xF30F, 0xF330, 0xF333, 0xF33C, 0xF33F,
+    0xF3C0, 0xF3C3, 0xF3CC, 0xF3CF, 0xF3F0, 0xF3F3, 0xF3FC, 0xF3FF,
+    0xFC00, 0xFC03, 0xFC0C, 0xFC0F, 0xFC30, 0xFC33, 0xFC3C, 0xFC3F,
+    0xFCC0, 0xFCC3, 0xFCCC, 0xFCCF, 0xFCF0, 0xFCF3, 0xFCFC, 0xFCFF,
+    0xFF00, 0xFF03, 0xFF0C, 0xFF0F, 0xFF30, 0xFF33, 0xFF3C, 0xFF3F,
+    0xFFC0, 0xFFC3, 0xFFCC, 0xFFCF, 0xFFF0, 0xFFF3, 0xFFFC, 0xFFFF,
+};
+
+const uint32_t font_expand3[256] = {
+    0x000000, 0x000007, 0x000038, 0x00003F, 0x0001C0, 0x0001C7,
+    0x0001F8, 0x0001FF, 0x000E00, 0x000E07, 0x000E38, 0x000E3F,
+    0x000FC0, 0x000FC7, 0x000FF8, 0x000FFF, 0x007000, 0x007007,
+    0x007038, 0x00703F, 0x0071C0, 0x0071C7, 0x0071F8, 0x0071FF,
+    0x007E00, 0x007E07, 0x007E38, 0x007E3F, 0x007FC0, 0x007FC7,
+    0x007FF8, 0x007FFF, 0x038000, 0x038007, 0x038038, 0x03803F,
+    0x0381C0, 0x0381C7, 0x0381F8, 0x0381FF, 0x038E00, 0x038E07,
+    0x038E38, 0x038E3F, 0x038FC0, 0x038FC7, 0x038FF8, 0x038FFF,
+    0x03F000, 0x03F007, 0x03F038, 0x03F03F, 0x03F1C0, 0x03F1C7,
+    0x03F1F8, 0x03F1FF, 0x03FE00, 0x03FE07, 0x03FE38, 0x03FE3F,
+    0x03FFC0, 0x03FFC7, 0x03FFF8, 0x03FFFF, 0x1C0000, 0x1C0007,
+    0x1C0038, 0x1C003F, 0x1C01C0, 0x1C01C7, 0x1C01F8, 0x1C01FF,
+    0x1C0E00, 0x1C0E07, 0x1C0E38, 0x1C0E3F, 0x1C0FC0, 0x1C0FC7,
+    0x1C0FF8, 0x1C0FFF, 0x1C7000, 0x1C7007, 0x1C7038, 0x1C703F,
+    0x1C71C0, 0x1C71C7, 0x1C71F8, 0x1C71FF, 0x1C7E00, 0x1C7E07,
+    0x1C7E38, 0x1C7E3F, 0x1C7FC0, 0x1C7FC7, 0x1C7FF8, 0x1C7FFF,
+    0x1F8000, 0x1F8007, 0x1F8038, 0x1F803F, 0x1F81C0, 0x1F81C7,
+    0x1F81F8, 0x1F81FF, 0x1F8E00, 0x1F8E07, 0x1F8E38, 0x1F8E3F,
+    0x1F8FC0, 0x1F8FC7, 0x1F8FF8, 0x1F8FFF, 0x1FF000, 0x1FF007,
+    0x1FF038, 0x1FF03F, 0x1FF1C0, 0x1FF1C7, 0x1FF1F8, 0x1FF1FF,
+    0x1FFE00, 0x1FFE07, 0x1FFE38, 0x1FFE3F, 0x1FFFC0, 0x1FFFC7,
+    0x1FFFF8, 0x1FFFFF, 0xE00000, 0xE00007, 0xE00038, 0xE0003F,
+    0xE001C0, 0xE001C7, 0xE001F8, 0xE001FF, 0xE00E00, 0xE00E07,
+    0xE00E38, 0xE00E3F, 0xE00FC0, 0xE00FC7, 0xE00FF8, 0xE00FFF,
+    0xE07000, 0xE07007, 0xE07038, 0xE0703F, 0xE071C0, 0xE071C7,
+    0xE071F8, 0xE071FF, 0xE07E00, 0xE07E07, 0xE07E38, 0xE07E3F,
+    0xE07FC0, 0xE07FC7, 0xE07FF8, 0xE07FFF, 0xE38000, 0xE38007,
+    0xE38038, 0xE3803F, 0xE381C0, 0xE381C7, 0xE381F8, 0xE381FF,
+    0xE38E00, 0xE38E07, 0xE38E38, 0xE38E3F, 0xE38FC0, 0xE38FC7,
+    0xE38FF8, 0xE38FFF, 0xE3F000, 0xE3F007, 0xE3F038, 0xE3F03F,
+    0xE3F1C0, 0xE3F1C7, 0xE3F1F8, 0xE3F1FF, 0xE3FE00, 0xE3FE07,
+    0xE3FE38, 0xE3FE3F, 0xE3FFC0, 0xE3FFC7, 0xE3FFF8, 0xE3FFFF,
+    0xFC0000, 0xFC0007, 0xFC0038, 0xFC003F, 0xFC01C0, 0xFC01C7,
+    0xFC01F8, 0xFC01FF, 0xFC0E00, 0xFC0E07, 0xFC0E38, 0xFC0E3F,
+    0xFC0FC0, 0xFC0FC7, 0xFC0FF8, 0xFC0FFF, 0xFC7000, 0xFC7007,
+    0xFC7038, 0xFC703F, 0xFC71C0, 0xFC71C7, 0xFC71F8, 0xFC71FF,
+    0xFC7E00, 0xFC7E07, 0xFC7E38, 0xFC7E3F, 0xFC7FC0, 0xFC7FC7,
+    0xFC7FF8, 0xFC7FFF, 0xFF8000, 0xFF8007, 0xFF8038, 0xFF803F,
+    0xFF81C0, 0xFF81C7, 0xFF81F8, 0xFF81FF, 0xFF8E00, 0xFF8E07,
+    0xFF8E38, 0xFF8E3F, 0xFF8FC0, 0xFF8FC7, 0xFF8FF8, 0xFF8FFF,
+    0xFFF000, 0xFFF007, 0xFFF038, 0xFFF03F, 0xFFF1C0, 0xFFF1C7,
+    0xFFF1F8, 0xFFF1FF, 0xFFFE00, 0xFFFE07, 0xFFFE38, 0xFFFE3F,
+    0xFFFFC0, 0xFFFFC7, 0xFFFFF8, 0xFFFFFF,
+};
+
+// font_digits: '-./0123456789' from tools/fonts/digits_12x20.txt
+static const uint8_t font_digits_bitmap[520] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80,
+    0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x1C, 0x00,
+    0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0x1F, 0x80, 0x7F, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0xF0,
+    0x7F, 0xE0, 0x1F, 0x80, 0x07, 0x00, 0x0F, 0x00, 0x3F, 0x00, 0x77, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x3F, 0xC0, 0x3F, 0xC0, 0x3F, 0xC0, 0x7F, 0xE0,
+    0xE0, 0x70, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x01, 0xE0,
+    0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00,
+    0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x3F, 0xC0, 0x7F, 0xE0, 0xE0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0xE0, 0x0F, 0x80, 0x0F, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0x7F, 0xE0, 0x3F, 0xC0, 0x01, 0xE0, 0x03, 0xE0, 0x07, 0xE0, 0x0E, 0xE0,
+    0x1C, 0xE0, 0x38, 0xE0, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xF0,
+    0xFF, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xFF, 0xF0, 0xFF, 0xF0,
+    0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0x70, 0x00, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x7F, 0xE0, 0x3F, 0xC0,
+    0x1F, 0xC0, 0x3F, 0xC0, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0xF0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xF0, 0xF0,
+    0x7F, 0xE0, 0x3F, 0xC0, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x70, 0x00, 0x70,
+    0x00, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x80,
+    0x07, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00,
+    0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x3F, 0xC0, 0x7F, 0xE0,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x70, 0xE0,
+    0x3F, 0xC0, 0x7F, 0xE0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0x7F, 0xE0, 0x3F, 0xC0,
+    0x3F, 0xC0, 0x7F, 0xE0, 0xF0, 0xF0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70,
+    0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0xF0, 0x7F, 0xF0, 0x3F, 0xF0,
+    0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0xE0,
+    0x3F, 0x80, 0x3F, 0x00,
+};
+
+const font_t font_digits = { font_digits_bitmap, 45, 13, 20, 2, 2, 24, 40, 26 };
@@ -1,19 +1,56 @@
-// This is a custom header for the GTK 3339
+// This is a custom header for the MTK3339
 // also known as the adafruit ultimate GPS
 // written by Sebastian Arthur
 
 #ifndef _GPS_H
 #define _GPS_H
 
-typedef volatile char* message; 
+#include <stdint.h>
+#include <stdbool.h>
+#include "nmea.h"
 
+// PMTK command table
+// Each entry holds the text between '$' and '*' with its checksum and packet
+// type worked out by the compiler (NMEA_CHECKSUM / PMTK_TYPE fold to constants),
+// so sending a command is just "$" body "*hh\r\n" with nothing computed at runtime.
 typedef struct {
-    message restart_type;
-} restart_message_t;
+    const char* body;   // e.g. "PMTK220,100"
+    uint8_t checksum;   // XOR of body
+    uint16_t type;      // Packet type echoed in the $PMTK001 acknowledgement
+    bool acked;         // False for commands the module never acknowledges
+} pmtk_command_t;
 
-static const restart_message_t COLD_RESTART = {
-    .cold_restart = "$PMTK104*37<CR><LF>"
-};
+// Packet type from the three digits after "PMTK"
+#define PMTK_TYPE(body) (((body)[4] - '0') * 100 + ((body)[5] - '0') * 10 + ((body)[6] - '0'))
 
+#define PMTK_COMMAND(body, acked) { body, NMEA_CHECKSUM(body), PMTK_TYPE(body), acked }
 
-#endif // _GPS_H
\ No newline at end of file
+// Restarts and baud changes reply with a boot message (or nothing), not $PMTK001
+static const pmtk_command_t COLD_RESTART = PMTK_COMMAND("PMTK104", false);
+static const pmtk_command_t SET_BAUD_57600 = PMTK_COMMAND("PMTK251,57600", false);
+static const pmtk_command_t SET_BAUD_115200 = PMTK_COMMAND("PMTK251,115200", false);
+
+// Fix interval
+static const pmtk_command_t SET_FIX_1HZ = PMTK_COMMAND("PMTK220,1000", true);
+static const pmtk_command_t SET_FIX_5HZ = PMTK_COMMAND("PMTK220,200", true);
+static const pmtk_command_t SET_FIX_10HZ = PMTK_COMMAND("PMTK220,100", true);
+
+// Standby until the module next receives a byte; the test packet is sent to
+// wake it (the wake-up byte itself may be lost, so it is acknowledged and resent)
+static const pmtk_command_t GPS_STANDBY = PMTK_COMMAND("PMTK161,0", true);
+static const pmtk_command_t GPS_TEST = PMTK_COMMAND("PMTK000", true);
+
+// Sentence output: GLL, RMC, VTG, GGA and GSA every fix, GSV every 5th fix
+// (the sky page needs GSV and GSA; a full GSV cycle is 3-4 sentences, so at
+// 10 Hz every fix would crowd the link for a sky that barely moves)
+static const pmtk_command_t SET_NMEA_OUTPUT = PMTK_COMMAND("PMTK314,1,1,1,1,1,5,0,0,0,0,0,0,0,0,0,0,0,0,0", true);
+
+// $PMTK001 flag values
+typedef enum {
+    PMTK_ACK_INVALID = 0,      // Invalid packet
+    PMTK_ACK_UNSUPPORTED = 1,  // Unsupported packet type
+    PMTK_ACK_FAILED = 2,       // Valid packet, but action failed
+    PMTK_ACK_SUCCEEDED = 3     // Valid packet, action succeeded
+} pmtk_ack_t;
+
+#endif // _GPS_H
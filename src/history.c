@@ -0,0 +1,15 @@
+#include "history.h"
+#include "hardware/sync.h"
+
+void speed_history_push(speed_history_t* h, uint32_t speed) {
+    uint32_t k = h->count;
+    h->speed[k % SPEED_HISTORY_LEN] = speed > 0xFFFF ? 0xFFFF : speed;
+    __dmb();  // Sample before count
+    h->count = k + 1;
+}
+
+uint32_t speed_history_count(const speed_history_t* h) {
+    uint32_t count = h->count;
+    __dmb();  // Count before the samples it covers
+    return count;
+}
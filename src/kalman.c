@@ -0,0 +1,197 @@
+#include <string.h>
+#include "kalman.h"
+#include "trig.h"
+
+void kalman_init(kalman_t* k) {
+    memset(k, 0, sizeof(*k));
+}
+
+// Millimetres north and east of the origin
+static void kalman_local(const kalman_t* k, int32_t latitude, int32_t longitude, int64_t* north, int64_t* east) {
+    int32_t dlon = longitude - k->longitude;
+    if (dlon > 180000000) dlon -= 360000000;  // Across the antimeridian
+    if (dlon < -180000000) dlon += 360000000;
+    *north = (int64_t)(latitude - k->latitude) * MM_PER_UDEG_NUM / MM_PER_UDEG_DEN;
+    *east = (int64_t)dlon * k->cos_latitude * MM_PER_UDEG_NUM / ((int64_t)MM_PER_UDEG_DEN << 15);
+}
+
+static void kalman_set_origin(kalman_t* k, int32_t latitude, int32_t longitude) {
+    k->latitude = latitude;
+    k->longitude = longitude;
+    k->cos_latitude = cos_q15((uint16_t)((int64_t)latitude * 65536 / 360000000));
+}
+
+// Reported speed and course as north/east mm/s
+static void kalman_velocity(const gps_data* g, int64_t v[2]) {
+    int64_t speed = (int64_t)g->speed * 100 / 36;  // km/h x 100 to mm/s
+    uint16_t angle = ANGLE_FROM_CENTIDEGREES(g->course);
+    v[0] = speed * cos_q15(angle) >> 15;
+    v[1] = speed * sin_q15(angle) >> 15;
+}
+
+// Speed and course from this sentence (fresh) or an earlier one
+static bool kalman_has_velocity(const gps_data* g, bool fresh) {
+    uint8_t needed = GPS_HAS_SPEED | GPS_HAS_COURSE;
+    if (fresh && !(g->fresh & GPS_HAS_SPEED)) return false;
+    return (g->valid & needed) == needed && g->fix;
+}
+
+// Position variance from HDOP, 0 if the position must not be used
+static int64_t kalman_position_variance(const gps_data* g) {
+    if (!(g->fresh & GPS_HAS_POSITION) || !(g->valid & GPS_HAS_POSITION) || !g->fix) return 0;
+    if (g->hdop == 0 || g->hdop > KALMAN_MAX_HDOP) return 0;
+    int64_t sigma = (int64_t)g->hdop * KALMAN_UERE / 100;
+    return sigma * sigma;
+}
+
+// Restart at a position, with the latest reported velocity if there is one
+static void kalman_start(kalman_t* k, const gps_data* g, int64_t r) {
+    int64_t v[2] = { 0, 0 };
+    int64_t speed_variance = (int64_t)KALMAN_INIT_SPEED * KALMAN_INIT_SPEED;
+    if (kalman_has_velocity(g, false)) {
+        kalman_velocity(g, v);
+        speed_variance = (int64_t)KALMAN_SPEED_SIGMA * KALMAN_SPEED_SIGMA;
+    }
+    memset(k->axis, 0, sizeof(k->axis));
+    for (int i = 0; i < 2; i++) {
+        kalman_axis_t* a = &k->axis[i];
+        a->x[1] = (int32_t)v[i];
+        a->p[0][0] = r;
+        a->p[1][1] = speed_variance;
+        a->p[2][2] = (int64_t)KALMAN_INIT_ACCEL * KALMAN_INIT_ACCEL;
+    }
+    kalman_set_origin(k, g->latitude, g->longitude);
+    k->active = true;
+    k->rejects = 0;
+    k->time_ms = g->updated_ms;
+}
+
+// x = F x, P = F P F' + Q over dt_ms
+// F has dt and dt^2 / 2 in Q16 seconds; Q = G G' for a random jerk, with G
+// (jerk * (dt^3 / 6, dt^2 / 2, dt)) in Q8 to keep short steps from rounding to 0
+static void kalman_predict(kalman_axis_t* a, uint32_t dt_ms) {
+    int64_t dt = dt_ms;
+    int64_t f1 = dt * 65536 / 1000;
+    int64_t f2 = dt * dt * 32768 / 1000000;
+    a->x[0] += (int32_t)(((int64_t)a->x[1] * f1 + (int64_t)a->x[2] * f2) >> 16);
+    a->x[1] += (int32_t)(((int64_t)a->x[2] * f1) >> 16);
+
+    int64_t fp[3][3];
+    for (int j = 0; j < 3; j++) {
+        fp[0][j] = a->p[0][j] + ((f1 * a->p[1][j] + f2 * a->p[2][j]) >> 16);
+        fp[1][j] = a->p[1][j] + ((f1 * a->p[2][j]) >> 16);
+        fp[2][j] = a->p[2][j];
+    }
+    int64_t g[3] = {
+        KALMAN_JERK * dt * dt * dt * 256 / 6000000000,
+        KALMAN_JERK * dt * dt * 256 / 2000000,
+        KALMAN_JERK * dt * 256 / 1000,
+    };
+    for (int i = 0; i < 3; i++) {
+        a->p[i][0] = fp[i][0] + ((f1 * fp[i][1] + f2 * fp[i][2]) >> 16);
+        a->p[i][1] = fp[i][1] + ((f1 * fp[i][2]) >> 16);
+        a->p[i][2] = fp[i][2];
+        for (int j = 0; j < 3; j++) a->p[i][j] += (g[i] * g[j]) >> 16;
+    }
+}
+
+// Scalar measurement z of state m with variance r
+static void kalman_measure(kalman_axis_t* a, int m, int64_t z, int64_t r) {
+    int64_t s = a->p[m][m] + r;
+    int64_t innovation = z - a->x[m];
+    int64_t row[3] = { a->p[m][0], a->p[m][1], a->p[m][2] };
+    for (int i = 0; i < 3; i++) {
+        int64_t gain = a->p[i][m] * 65536 / s;  // Q16
+        a->x[i] += (int32_t)((gain * innovation) >> 16);
+        for (int j = 0; j < 3; j++) a->p[i][j] -= (gain * row[j]) >> 16;
+    }
+}
+
+// Squared distance of a position measurement from the prediction, in sigma^2 x 256
+static int64_t kalman_distance(const kalman_t* k, const int64_t z[2], int64_t r) {
+    int64_t d = 0;
+    for (int i = 0; i < 2; i++) {
+        int64_t innovation = z[i] - k->axis[i].x[0];
+        d += innovation * innovation * 256 / (k->axis[i].p[0][0] + r);
+    }
+    return d;
+}
+
+bool kalman_update(kalman_t* k, const gps_data* g, bool velocity) {
+    int64_t r = kalman_position_variance(g);
+    velocity = velocity && kalman_has_velocity(g, true);
+    if (!k->active || g->updated_ms - k->time_ms > KALMAN_MAX_GAP_MS) {
+        k->active = false;
+        if (r) kalman_start(k, g, r);
+        return k->active;
+    }
+    if (!r && !velocity) return false;
+
+    uint32_t dt = g->updated_ms - k->time_ms;
+    for (int i = 0; i < 2; i++) kalman_predict(&k->axis[i], dt);
+    k->time_ms = g->updated_ms;
+
+    if (r) {
+        int64_t z[2];
+        kalman_local(k, g->latitude, g->longitude, &z[0], &z[1]);
+        if (kalman_distance(k, z, r) > KALMAN_GATE * KALMAN_GATE * 256) {
+            if (++k->rejects > KALMAN_MAX_REJECTS) kalman_start(k, g, r);
+        } else {
+            k->rejects = 0;
+            for (int i = 0; i < 2; i++) {
+                kalman_measure(&k->axis[i], 0, z[i], r);
+                k->axis[i].x[0] -= (int32_t)z[i];  // Re-center on the measurement
+            }
+            kalman_set_origin(k, g->latitude, g->longitude);
+        }
+    }
+    if (velocity) {
+        int64_t v[2];
+        kalman_velocity(g, v);
+        for (int i = 0; i < 2; i++) {
+            kalman_measure(&k->axis[i], 1, v[i], (int64_t)KALMAN_SPEED_SIGMA * KALMAN_SPEED_SIGMA);
+        }
+    }
+    return true;
+}
+
+bool kalman_motion(const kalman_t* k, gps_motion_t* out) {
+    if (!k->active) return false;
+    out->time_ms = k->time_ms;
+    out->latitude = k->latitude;
+    out->longitude = k->longitude;
+    out->cos_latitude = k->cos_latitude;
+    for (int i = 0; i < 2; i++) {
+        out->position[i] = k->axis[i].x[0];
+        out->velocity[i] = k->axis[i].x[1];
+        out->accel[i] = k->axis[i].x[2];
+    }
+    return true;
+}
+
+// Milliseconds from the state to now_ms, within the prediction horizon
+static int64_t kalman_elapsed(const gps_motion_t* m, uint32_t now_ms) {
+    int32_t t = (int32_t)(now_ms - m->time_ms);  // The fix may be newer than now_ms
+    if (t < 0) return 0;
+    return t > KALMAN_MAX_PREDICT_MS ? KALMAN_MAX_PREDICT_MS : t;
+}
+
+uint32_t kalman_speed_at(const gps_motion_t* m, uint32_t now_ms) {
+    int64_t t = kalman_elapsed(m, now_ms);
+    int64_t north = m->velocity[0] + (int64_t)m->accel[0] * t / 1000;
+    int64_t east = m->velocity[1] + (int64_t)m->accel[1] * t / 1000;
+    return (uint32_t)(hypot64(north, east) * 36 / 100);
+}
+
+void kalman_position_at(const gps_motion_t* m, uint32_t now_ms, int32_t* latitude, int32_t* longitude) {
+    int64_t t = kalman_elapsed(m, now_ms);
+    int64_t d[2];
+    for (int i = 0; i < 2; i++) {
+        d[i] = m->position[i] + (int64_t)m->velocity[i] * t / 1000 + (int64_t)m->accel[i] * t * t / 2000000;
+    }
+    *latitude = m->latitude + (int32_t)(d[0] * MM_PER_UDEG_DEN / MM_PER_UDEG_NUM);
+    *longitude = m->longitude;
+    if (m->cos_latitude > 0) {
+        *longitude += (int32_t)(d[1] * ((int64_t)MM_PER_UDEG_DEN << 15) / ((int64_t)MM_PER_UDEG_NUM * m->cos_latitude));
+    }
+}
@@ -1,4 +1,3 @@
-#define PI 3.14159265358979323846
 // screen dimensions 
 #define TFT_WIDTH   240
 #define TFT_HEIGHT  320
@@ -6,13 +5,29 @@
 // RGB565 color format helper
 #define RGB565(r, g, b) (((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3))
 #define BGR565(r, g, b) (((b & 0xF8) << 8) | ((g & 0xFC) << 3) | ((r & 0xF8) >> 3)) 
-#define FONT_SCALE 2  // Scale factor to make text bigger (2x = double size)
-uint16_t line_height = (FONT_HEIGHT * FONT_SCALE) + 4;  // 4px spacing between lines
+
+// SPI transport (defined in main.c)
+typedef void (*spi_burst_cb_t)(void);  // Called when a burst has completed
+
+typedef struct {
+    uint32_t transactions;  // CS assert/deassert cycles
+    uint32_t bytes;         // Bytes clocked out
+    uint32_t windows;       // tft_set_window calls
+} spi_stats_t;
+
+extern spi_stats_t spi_stats;
+
+void send_spi_cmd(spi_inst_t *spi, uint8_t cmd);
+void send_spi_data16(spi_inst_t *spi, uint16_t data, bool is_long);
+void spi_burst_fill(uint16_t color, uint32_t count, spi_burst_cb_t done);
+void spi_burst_write(const uint16_t* pixels, uint32_t count, spi_burst_cb_t done);
+void spi_burst_wait();
 
 // Set the drawing window on the display
 // Defines the rectangular area where pixels will be written
 // Parameters: (x0, y0) = top-left corner, (x1, y1) = bottom-right corner
 void tft_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    spi_stats.windows++;
     send_spi_cmd(spi0, 0x2A); // Column address set command
     send_spi_data16(spi0, x0, true); // Start column
     send_spi_data16(spi0, x1, true); // End column
@@ -24,84 +39,285 @@ void tft_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
     send_spi_cmd(spi0, 0x2C); // Memory write command (ready to receive pixel data)
 }
 
+// Hardware vertical scrolling
+// 0x33 splits the panel rows into a fixed top area, a scrolling area and a
+// fixed bottom area; 0x37 picks the memory row shown at the top of the
+// scrolling area. Drawing still addresses memory rows, only what is shown
+// moves. With the whole panel fixed-top or start == top nothing is scrolled.
+void tft_scroll_area(uint16_t top, uint16_t rows) {
+    send_spi_cmd(spi0, 0x33); // Vertical scrolling definition
+    send_spi_data16(spi0, top, true); // Top fixed area
+    send_spi_data16(spi0, rows, true); // Scrolling area
+    send_spi_data16(spi0, TFT_HEIGHT - top - rows, true); // Bottom fixed area
+}
+
+void tft_send_scroll_start(uint16_t row) {
+    send_spi_cmd(spi0, 0x37); // Vertical scrolling start address
+    send_spi_data16(spi0, row, true);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// RAM framebuffer
+// When tft_target is TFT_TARGET_FRAMEBUFFER the drawing primitives write into
+// framebuffer[] instead of the display and mark the 16x16 tiles they touch as
+// dirty. tft_fb_flush then sends only the dirty tiles, merging neighbouring
+// dirty tiles into one window per run.
+#define TILE_SIZE 16
+#define TILES_X (TFT_WIDTH / TILE_SIZE)   // 15 tile columns
+#define TILES_Y (TFT_HEIGHT / TILE_SIZE)  // 20 tile rows
+
+typedef enum {
+    TFT_TARGET_DISPLAY,      // Draw straight to the panel over SPI
+    TFT_TARGET_FRAMEBUFFER   // Draw into framebuffer[], flush later
+} tft_target_t;
+
+tft_target_t tft_target = TFT_TARGET_DISPLAY;
+uint16_t framebuffer[TFT_WIDTH * TFT_HEIGHT];  // Row-major RGB565
+uint16_t fb_dirty[TILES_Y];                    // Bit n = tile column n is dirty
+int32_t fb_scroll_start = -1;                  // Scroll start waiting for the flush, -1 if none
+
+// Set by the input interrupt when the page being drawn is out of date, and
+// cleared by whoever starts the next page. While it is set, widgets report
+// "unchanged", so the rest of the page is skipped without losing track of what
+// is on screen, and tft_fb_flush stops at the next band, leaving the unsent
+// tiles dirty for the next flush.
+volatile bool draw_cancel = false;
+
+// Mark every tile overlapping the rectangle as dirty (coordinates already clipped)
+void fb_mark_dirty(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    uint16_t tx0 = x0 / TILE_SIZE, tx1 = x1 / TILE_SIZE;
+    uint16_t bits = ((1u << (tx1 + 1)) - 1) & ~((1u << tx0) - 1);
+    for (uint16_t ty = y0 / TILE_SIZE; ty <= y1 / TILE_SIZE; ty++) {
+        fb_dirty[ty] |= bits;
+    }
+}
+
+// Fill a rectangle of the framebuffer, clipped to the screen
+void fb_fill_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    if (x0 >= TFT_WIDTH || y0 >= TFT_HEIGHT || x1 < x0 || y1 < y0) return;
+    if (x1 >= TFT_WIDTH) x1 = TFT_WIDTH - 1;
+    if (y1 >= TFT_HEIGHT) y1 = TFT_HEIGHT - 1;
+    for (uint16_t y = y0; y <= y1; y++) {
+        uint16_t* row = &framebuffer[y * TFT_WIDTH];
+        for (uint16_t x = x0; x <= x1; x++) {
+            row[x] = color;
+        }
+    }
+    fb_mark_dirty(x0, y0, x1, y1);
+}
+
+// Copy a width x rows block of pixels into the framebuffer at (x, y)
+// The caller has already clipped the block to the screen
+void fb_blit(uint16_t x, uint16_t y, uint16_t width, uint16_t rows, const uint16_t* pixels) {
+    for (uint16_t r = 0; r < rows; r++) {
+        memcpy(&framebuffer[(y + r) * TFT_WIDTH + x], &pixels[r * width], width * sizeof(uint16_t));
+    }
+    fb_mark_dirty(x, y, x + width - 1, y + rows - 1);
+}
+
+// Send every dirty tile to the display and clear the dirty map
+// A run of dirty tiles in a tile row becomes one window, and identical runs in the
+// rows below are merged into it. Full-width windows go out as one burst per
+// tile row, narrower ones as one burst per pixel row inside the same window;
+// draw_cancel is checked between tile rows.
+// Returns the number of pixels sent
+uint32_t tft_fb_flush() {
+    uint32_t pixels = 0;
+    for (uint16_t ty = 0; ty < TILES_Y && !draw_cancel; ty++) {
+        while (fb_dirty[ty] && !draw_cancel) {
+            // Find the first run of consecutive dirty tiles in this row
+            uint16_t tx0 = 0;
+            while (!(fb_dirty[ty] & (1u << tx0))) tx0++;
+            uint16_t tx1 = tx0;
+            while (tx1 + 1 < TILES_X && (fb_dirty[ty] & (1u << (tx1 + 1)))) tx1++;
+            uint16_t run = ((1u << (tx1 + 1)) - 1) & ~((1u << tx0) - 1);
+
+            // Extend down over rows that have exactly this run dirty
+            uint16_t ty1 = ty;
+            while (ty1 + 1 < TILES_Y && (fb_dirty[ty1 + 1] & run) == run &&
+                   !(fb_dirty[ty1 + 1] & ((run << 1) | (run >> 1)) & ~run)) {
+                ty1++;
+            }
+            for (uint16_t t = ty; t <= ty1; t++) {
+                fb_dirty[t] &= ~run;
+            }
+
+            uint16_t x0 = tx0 * TILE_SIZE, x1 = (tx1 + 1) * TILE_SIZE - 1;
+            uint16_t y0 = ty * TILE_SIZE, y1 = (ty1 + 1) * TILE_SIZE - 1;
+            uint16_t width = x1 - x0 + 1;
+            tft_set_window(x0, y0, x1, y1);
+            for (uint16_t y = y0; y <= y1; y += TILE_SIZE) {
+                if (draw_cancel) {
+                    fb_mark_dirty(x0, y, x1, y1);  // The rest goes out with the next flush
+                    break;
+                }
+                if (width == TFT_WIDTH) {
+                    // Rows are contiguous in memory
+                    spi_burst_write(&framebuffer[y * TFT_WIDTH], (uint32_t)width * TILE_SIZE, NULL);
+                } else {
+                    for (uint16_t row = y; row < y + TILE_SIZE; row++) {
+                        spi_burst_write(&framebuffer[row * TFT_WIDTH + x0], width, NULL);
+                    }
+                }
+                pixels += (uint32_t)width * TILE_SIZE;
+            }
+        }
+    }
+    // Scroll only once the rows it reveals are on the panel
+    if (fb_scroll_start >= 0 && !draw_cancel) {
+        tft_send_scroll_start(fb_scroll_start);
+        fb_scroll_start = -1;
+    }
+    spi_burst_wait();  // The framebuffer may be drawn into again right away
+    return pixels;
+}
+
+// Set the vertical scrolling start address (see tft_scroll_area)
+// In the framebuffer the rows are drawn but not yet sent, so the change
+// waits for tft_fb_flush
+void tft_scroll_start(uint16_t row) {
+    if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+        fb_scroll_start = row;
+        return;
+    }
+    tft_send_scroll_start(row);
+}
+
+// Write the framebuffer as a binary PPM (P6) image, in panel memory row order
+// (the speed graph unscrolled). The sim writes one per page under --ppm, as
+// <page>.fb.ppm next to the decoded panel, for golden images and diffs
+void tft_fb_dump_ppm(FILE* out) {
+    fprintf(out, "P6\n%d %d\n255\n", TFT_WIDTH, TFT_HEIGHT);
+    for (uint32_t i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) {
+        uint16_t c = framebuffer[i];
+        // Expand RGB565 to 8 bits per channel
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31)
+        };
+        fwrite(rgb, 1, 3, out);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 // Fill the entire screen with a solid color
 // This clears the screen and sets it to the specified background color
 void tft_fill_screen(uint16_t color) {
+    if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+        fb_fill_rect(0, 0, TFT_WIDTH - 1, TFT_HEIGHT - 1, color);
+        return;
+    }
     // Set window to cover entire screen
     tft_set_window(0, 0, TFT_WIDTH - 1, TFT_HEIGHT - 1);
     
-    // Fill all pixels with the specified color
+    // Stream the color to every pixel in one DMA burst
     // Total pixels = width * height
     uint32_t total_pixels = TFT_WIDTH * TFT_HEIGHT;
-    for (uint32_t i = 0; i < total_pixels; i++) {
-        send_spi_data16(spi0, color, true);
-    }
+    spi_burst_fill(color, total_pixels, NULL);
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
-#define FONT_SCALE 2  // Scale factor to make text bigger (2x = double size)
-
 // Draw a single pixel (helper function)
 // Sets the display window to a single pixel and writes the color
 void tft_draw_pixel(uint16_t x, uint16_t y, uint16_t color) {
+    if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+        fb_fill_rect(x, y, x, y, color);
+        return;
+    }
     tft_set_window(x, y, x, y);
     send_spi_data16(spi0, color, true);
 }
 
-// Draw a scaled pixel block (makes text bigger)
-// Draws a FONT_SCALE x FONT_SCALE block of pixels at position (x, y)
-void tft_draw_scaled_pixel(uint16_t x, uint16_t y, uint16_t color) {
-    for (uint8_t i = 0; i < FONT_SCALE; i++) {
-        for (uint8_t j = 0; j < FONT_SCALE; j++) {
-            tft_draw_pixel(x + i, y + j, color);
-        }
-    }
+// Text is rasterized into this RAM strip and sent with one window and one burst
+// One strip row holds a full screen width of RGB565 pixels; text taller than
+// the strip holds at its width goes out in several bands
+#define TEXT_STRIP_HEIGHT 16
+uint16_t text_strip[TFT_WIDTH * TEXT_STRIP_HEIGHT];
+
+// Pixel width of len characters, without spacing after the last one
+uint32_t font_text_width(const font_t* font, size_t len) {
+    return len ? len * font->advance - (font->advance - font->width) : 0;
 }
 
-// Draw a single character at position (x, y) with scaling
-// Reads the font bitmap and draws each pixel scaled up
-void tft_draw_char(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg_color) {
-    const unsigned char* char_data = get_char_data(c);
-    
-    // Draw each row of the font
-    for (uint8_t row = 0; row < FONT_HEIGHT; row++) {
-        unsigned char row_data = char_data[row];
-        // Draw each column (bit) in the row
-        for (uint8_t col = 0; col < FONT_WIDTH; col++) {
-            // Check if bit is set (MSB first, so bit 7 is leftmost)
-            // 0x80 >> col extracts each bit from left to right
-            if (row_data & (0x80 >> col)) {
-                // Draw foreground color (scaled)
-                tft_draw_scaled_pixel(x + (col * FONT_SCALE), y + (row * FONT_SCALE), color);
-            } else {
-                // Draw background color (scaled)
-                tft_draw_scaled_pixel(x + (col * FONT_SCALE), y + (row * FONT_SCALE), bg_color);
+// Draw len characters of str as one run starting at (x, y), at most max_width pixels wide
+// Each glyph row is expanded once through the font's lookup table and copied
+// font->scale times, then the strip is pushed with a single window per band;
+// text past the screen edge is clipped
+void tft_draw_text_clipped(uint16_t x, uint16_t y, const font_t* font, const char* str, size_t len,
+                           uint16_t max_width, uint16_t color, uint16_t bg_color) {
+    if (len == 0 || x >= TFT_WIDTH || y >= TFT_HEIGHT) return;
+    if (max_width > TFT_WIDTH - x) max_width = TFT_WIDTH - x;
+
+    uint32_t full_width = font_text_width(font, len);
+    uint16_t width = full_width > max_width ? max_width : full_width;
+    if (width == 0) return;
+    uint16_t rows = font->height > TFT_HEIGHT - y ? TFT_HEIGHT - y : font->height;
+    uint16_t band = sizeof(text_strip) / sizeof(text_strip[0]) / width;  // Rows per burst
+
+    for (uint16_t top = 0; top < rows; top += band) {
+        uint16_t band_rows = rows - top < band ? rows - top : band;
+        spi_burst_wait();  // The previous run may still be streaming from the strip
+
+        for (uint16_t r = 0; r < band_rows; r++) {
+            uint16_t* line = &text_strip[r * width];
+            uint16_t row = top + r;
+            // Rows after the first of each source row repeat it to scale vertically
+            if (r > 0 && row % font->scale) {
+                memcpy(line, line - width, width * sizeof(uint16_t));
+                continue;
             }
+            uint16_t px = 0;
+            // Expand this font row across every character in the run
+            for (size_t i = 0; i < len && px < width; i++) {
+                const uint8_t* glyph = font_glyph(font, str[i]);
+                uint32_t bits = glyph ? font_expand_row(font, glyph + (row / font->scale) * font->bytes_per_row) : 0;
+                for (uint8_t col = 0; col < font->width && px < width; col++, bits <<= 1) {
+                    line[px++] = (bits & 0x80000000u) ? color : bg_color;
+                }
+                for (uint8_t col = font->width; col < font->advance && px < width; col++) {
+                    line[px++] = bg_color;  // Spacing columns
+                }
+            }
+        }
+
+        if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+            fb_blit(x, y + top, width, band_rows, text_strip);
+            continue;
         }
+        tft_set_window(x, y + top, x + width - 1, y + top + band_rows - 1);
+        spi_burst_write(text_strip, (uint32_t)width * band_rows, NULL);
     }
 }
 
-// Print a string starting at position (x, y)
-// Iterates through each character and draws it with proper spacing
-void tft_print_string(uint16_t x, uint16_t y, const char* str, uint16_t color, uint16_t bg_color) {
-    uint16_t x_pos = x;
-    // Draw each character in the string
-    while (*str) {
-        tft_draw_char(x_pos, y, *str++, color, bg_color);
-        // Move to next character position (scaled width + spacing)
-        x_pos += (FONT_WIDTH * FONT_SCALE) + 1;
-    }
+// Draw len characters of str as one run starting at (x, y)
+void tft_draw_text(uint16_t x, uint16_t y, const font_t* font, const char* str, size_t len,
+                   uint16_t color, uint16_t bg_color) {
+    tft_draw_text_clipped(x, y, font, str, len, TFT_WIDTH, color, bg_color);
+}
+
+// Draw a single character at position (x, y)
+void tft_draw_char(uint16_t x, uint16_t y, const font_t* font, char c, uint16_t color, uint16_t bg_color) {
+    tft_draw_text(x, y, font, &c, 1, color, bg_color);
+}
+
+// Print a string starting at position (x, y) in the given font
+// The whole string is drawn as one run (one window, one burst)
+void tft_print_string(uint16_t x, uint16_t y, const font_t* font, const char* str, uint16_t color, uint16_t bg_color) {
+    tft_draw_text(x, y, font, str, strlen(str), color, bg_color);
 }
 
 // Print a string with automatic line wrapping at word boundaries
 // Breaks text into multiple lines, wrapping at spaces/punctuation instead of mid-word
 // Parameters: start_x, start_y = starting position, line_height = spacing between lines
-void tft_print_multiline(uint16_t start_x, uint16_t start_y, const char* str, 
+void tft_print_multiline(uint16_t start_x, uint16_t start_y, const font_t* font, const char* str,
                          uint16_t color, uint16_t bg_color, uint16_t line_height) {
     uint16_t x = start_x;
     uint16_t y = start_y;
-    uint16_t char_width = (FONT_WIDTH * FONT_SCALE) + 1;  // Width of one character
+    uint16_t char_width = font->advance;  // Width of one character
     uint16_t max_chars_per_line = (TFT_WIDTH - start_x - 10) / char_width;  // Max chars per line (with margin)
     
     const char* word_start = str;  // Start of current word
@@ -119,12 +335,11 @@ void tft_print_multiline(uint16_t start_x, uint16_t start_y, const char* str,
                 line_chars = 0;
             }
             
-            // Draw the word
-            while (word_start <= str) {
-                tft_draw_char(x, y, *word_start++, color, bg_color);
-                x += char_width;
-                line_chars++;
-            }
+            // Draw the word (including the boundary character) as one run
+            size_t run = str - word_start + 1;
+            tft_draw_text(x, y, font, word_start, run, color, bg_color);
+            x += run * char_width;
+            line_chars += run;
             
             word_start = str + 1;  // Next word starts after this space/punctuation
             word_length = 0;
@@ -144,53 +359,62 @@ void tft_print_multiline(uint16_t start_x, uint16_t start_y, const char* str,
         }
         
         // Draw the remaining word
-        while (*word_start) {
-            tft_draw_char(x, y, *word_start++, color, bg_color);
-            x += char_width;
-        }
+        tft_draw_text(x, y, font, word_start, strlen(word_start), color, bg_color);
     }
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+// Fill one horizontal span x0..x1 (inclusive) of row y, clipped to the screen
+// On the display this is one window and one DMA fill
+void tft_draw_span(int x0, int x1, int y, uint16_t color) {
+    if (y < 0 || y >= TFT_HEIGHT) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 >= TFT_WIDTH) x1 = TFT_WIDTH - 1;
+    if (x0 > x1) return;
+    if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+        fb_fill_rect(x0, y, x1, y, color);
+        return;
+    }
+    tft_set_window(x0, y, x1, y);
+    spi_burst_fill(color, x1 - x0 + 1, NULL);
+}
+
 // Draw a filled circle with specified color
 // Parameters: cx, cy = center coordinates, radius = circle radius, color = fill color
+// Midpoint circle: err tracks r^2 - x^2 - y^2 as the half width x shrinks row
+// by row, so every pixel with dx^2 + dy^2 <= r^2 is covered by exactly one span
 void tft_draw_circle(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t color) {
-    // Iterate through all pixels in the bounding box of the circle
-    for (int16_t y = cy - radius; y <= cy + radius; y++) {
-        for (int16_t x = cx - radius; x <= cx + radius; x++) {
-            // Calculate distance from center
-            int16_t dx = x - cx;
-            int16_t dy = y - cy;
-            int32_t distance_squared = dx * dx + dy * dy;
-            int32_t radius_squared = radius * radius;
-            
-            // Draw pixel if it's inside the circle
-            if (distance_squared <= radius_squared) {
-                // Check bounds to avoid drawing outside screen
-                if (x >= 0 && x < TFT_WIDTH && y >= 0 && y < TFT_HEIGHT) {
-                    tft_draw_pixel(x, y, color);
-                }
-            }
+    int x = radius;
+    int32_t err = 0;
+    for (int y = 0; y <= radius; y++) {
+        while (err < 0) {
+            err += 2 * x - 1;
+            x--;
         }
+        tft_draw_span(cx - x, cx + x, cy + y, color);
+        if (y) tft_draw_span(cx - x, cx + x, cy - y, color);
+        err -= 2 * y + 1;
     }
 }
 
 // Draw a filled rectangle (box) with specified color
 // Parameters: x0, y0 = top-left corner, x1, y1 = bottom-right corner, color = fill color
 void tft_draw_box(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+        fb_fill_rect(x0, y0, x1, y1, color);
+        return;
+    }
     // Set window to the rectangle area
     tft_set_window(x0, y0, x1, y1);
     
     // Calculate number of pixels
     uint16_t width = x1 - x0 + 1;
     uint16_t height = y1 - y0 + 1;
-    uint32_t total_pixels = width * height;
+    uint32_t total_pixels = (uint32_t)width * height;
     
-    // Fill all pixels with the specified color
-    for (uint32_t i = 0; i < total_pixels; i++) {
-        send_spi_data16(spi0, color, true);
-    }
+    // Fill all pixels with the specified color in one DMA burst
+    spi_burst_fill(color, total_pixels, NULL);
 }
 
 // Draw a line from (x0, y0) to (x1, y1) with specified color
@@ -231,46 +455,367 @@ void tft_draw_line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t
 
 // Draw a thick line from (x0, y0) to (x1, y1) with specified width and color
 // Parameters: x0, y0 = start point, x1, y1 = end point, width = line width in pixels, color = line color
+// The line is the rectangle reaching width/2 either side of the center line;
+// each row of it is one span between the leftmost and rightmost edge crossings,
+// so every pixel is written once. Corners are in 1/16 pixel fixed point
+// (THICK_LINE_SUB bits) and the length comes from isqrt32, so no float math.
+#define THICK_LINE_SUB 4
+
 void tft_draw_thick_line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t width, uint16_t color) {
-    // Calculate the perpendicular direction for the width offset
-    float dx = (float)x1 - (float)x0;
-    float dy = (float)y1 - (float)y0;
-    float length = sqrtf(dx * dx + dy * dy);
-        
-    // Normalize and get perpendicular vector
-    float perp_x = -dy / length;
-    float perp_y = dx / length;
-    
-    // Draw multiple parallel lines to create thickness
-    int half_width = width / 2;
-    for (int offset = -half_width; offset <= half_width; offset++) {
-        int offset_x = (int)(perp_x * offset);
-        int offset_y = (int)(perp_y * offset);
-        tft_draw_line(x0 + offset_x, y0 + offset_y, x1 + offset_x, y1 + offset_y, color);
+    int32_t dx = (int32_t)x1 - x0;
+    int32_t dy = (int32_t)y1 - y0;
+    int32_t length = isqrt32((uint32_t)(dx * dx + dy * dy) << (2 * THICK_LINE_SUB));
+    if (length == 0) {
+        int half = width / 2;
+        for (int y = y0 - half; y <= y0 + half; y++) tft_draw_span(x0 - half, x0 + half, y, color);
+        return;
+    }
+
+    // Corners of the quad, in order around it: the perpendicular -dy, dx scaled
+    // to width/2, rounded to the nearest sub-pixel
+    int32_t scale = (int32_t)width << (2 * THICK_LINE_SUB - 1);
+    int32_t px = -dy * scale, py = dx * scale;
+    px = (px + (px < 0 ? -length : length) / 2) / length;
+    py = (py + (py < 0 ? -length : length) / 2) / length;
+    int32_t sx0 = (int32_t)x0 << THICK_LINE_SUB, sy0 = (int32_t)y0 << THICK_LINE_SUB;
+    int32_t sx1 = (int32_t)x1 << THICK_LINE_SUB, sy1 = (int32_t)y1 << THICK_LINE_SUB;
+    int32_t qx[4] = { sx0 + px, sx1 + px, sx1 - px, sx0 - px };
+    int32_t qy[4] = { sy0 + py, sy1 + py, sy1 - py, sy0 - py };
+    int32_t top = qy[0], bottom = qy[0];
+    for (int i = 1; i < 4; i++) {
+        if (qy[i] < top) top = qy[i];
+        if (qy[i] > bottom) bottom = qy[i];
+    }
+
+    // Fill the pixel centers between the crossings on each row
+    // (>> rounds toward minus infinity, so ceil is (v + one - 1) >> SUB)
+    int32_t one = 1 << THICK_LINE_SUB;
+    for (int y = (top + one - 1) >> THICK_LINE_SUB; y <= bottom >> THICK_LINE_SUB; y++) {
+        int32_t sy = (int32_t)y << THICK_LINE_SUB;
+        int32_t left = INT32_MAX, right = INT32_MIN;
+        for (int i = 0; i < 4; i++) {
+            int32_t ax = qx[i], ay = qy[i];
+            int32_t bx = qx[(i + 1) % 4], by = qy[(i + 1) % 4];
+            if (ay == by || sy < (ay < by ? ay : by) || sy > (ay > by ? ay : by)) continue;
+            int32_t x = ax + (bx - ax) * (sy - ay) / (by - ay);
+            if (x < left) left = x;
+            if (x > right) right = x;
+        }
+        if (left <= right) {
+            tft_draw_span((left + one - 1) >> THICK_LINE_SUB, right >> THICK_LINE_SUB, y, color);
+        }
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-// Display Speed: [value] km/h in a blue box with progress bar
-// Parameters: x, y = position of top-left corner of the label box, 
-//             speed_str = speed string to display, max_speed = maximum speed for progress bar, all = display mode
-void display_speed(uint16_t x, uint16_t y, const char* speed_str, bool all) {
+// Pre-rendered backgrounds (see background.h)
+// Runs of at least BG_FILL_MIN pixels go to the display as DMA fills; shorter
+// runs and literal pixels are staged in the text strip and sent as bursts.
+#define BG_FILL_MIN 32
+
+// Decode columns x0..x1 of row y into out
+void bg_decode_row(const bg_image_t* img, uint16_t y, uint16_t x0, uint16_t x1, uint16_t* out) {
+    const uint16_t* p = img->data + img->rows[y];
+    uint16_t x = 0;
+    while (x <= x1) {
+        uint16_t word = *p++;
+        uint16_t n = word & ~BG_LITERAL;
+        // Part of this run that falls inside x0..x1
+        int from = x < x0 ? x0 : x;
+        int to = x + n - 1 > x1 ? x1 : x + n - 1;
+        if (word & BG_LITERAL) {
+            for (int i = from; i <= to; i++) out[i - x0] = p[i - x];
+            p += n;
+        } else {
+            for (int i = from; i <= to; i++) out[i - x0] = *p;
+            p++;
+        }
+        x += n;
+    }
+}
+
+// Send the staged pixels and switch to the other half of the strip,
+// which the previous burst has finished with by the time this one starts
+void bg_send_staged(uint16_t** stage, uint32_t* staged) {
+    if (*staged == 0) return;
+    spi_burst_write(*stage, *staged, NULL);
+    uint32_t half = sizeof(text_strip) / sizeof(text_strip[0]) / 2;
+    *stage = *stage == text_strip ? text_strip + half : text_strip;
+    *staged = 0;
+}
+
+// Draw a whole background at the top left of the screen
+// On the display the image is one window; the decoder feeds it run by run
+void tft_draw_background(const bg_image_t* img) {
+    if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+        for (uint16_t y = 0; y < img->height; y++) {
+            bg_decode_row(img, y, 0, img->width - 1, &framebuffer[y * TFT_WIDTH]);
+        }
+        fb_mark_dirty(0, 0, img->width - 1, img->height - 1);
+        return;
+    }
+
+    uint32_t half = sizeof(text_strip) / sizeof(text_strip[0]) / 2;
+    uint16_t* stage = text_strip;
+    uint32_t staged = 0;
+    spi_burst_wait();  // The strip may still be streaming
+    tft_set_window(0, 0, img->width - 1, img->height - 1);
+
+    const uint16_t* p = img->data;
+    uint32_t remaining = (uint32_t)img->width * img->height;
+    while (remaining) {
+        uint16_t word = *p++;
+        uint16_t n = word & ~BG_LITERAL;
+        remaining -= n;
+        if (!(word & BG_LITERAL) && n >= BG_FILL_MIN) {
+            bg_send_staged(&stage, &staged);
+            spi_burst_fill(*p++, n, NULL);
+            continue;
+        }
+        for (uint16_t i = 0; i < n; i++) {
+            if (staged == half) bg_send_staged(&stage, &staged);
+            stage[staged++] = (word & BG_LITERAL) ? p[i] : *p;
+        }
+        p += (word & BG_LITERAL) ? n : 1;
+    }
+    bg_send_staged(&stage, &staged);
+}
+
+// Repaint a rectangle (inclusive) from a background
+// Rows are decoded into the text strip and sent a band at a time
+void bg_restore(const bg_image_t* img, int x0, int y0, int x1, int y1) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= img->width) x1 = img->width - 1;
+    if (y1 >= img->height) y1 = img->height - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+        for (int y = y0; y <= y1; y++) {
+            bg_decode_row(img, y, x0, x1, &framebuffer[y * TFT_WIDTH + x0]);
+        }
+        fb_mark_dirty(x0, y0, x1, y1);
+        return;
+    }
+    uint16_t width = x1 - x0 + 1;
+    uint16_t band = sizeof(text_strip) / sizeof(text_strip[0]) / width;  // Rows per burst
+    for (int y = y0; y <= y1; y += band) {
+        uint16_t rows = y1 - y + 1 < band ? y1 - y + 1 : band;
+        spi_burst_wait();  // The previous band may still be streaming from the strip
+        for (uint16_t row = 0; row < rows; row++) {
+            bg_decode_row(img, y + row, x0, x1, &text_strip[row * width]);
+        }
+        tft_set_window(x0, y, x1, y + rows - 1);
+        spi_burst_write(text_strip, (uint32_t)width * rows, NULL);
+    }
+}
+
+// Bounding box (inclusive) of a tft_draw_thick_line, with a pixel to spare
+void thick_line_bounds(int x0, int y0, int x1, int y1, int width, int box[4]) {
+    int pad = width / 2 + 1;
+    box[0] = (x0 < x1 ? x0 : x1) - pad;
+    box[1] = (y0 < y1 ? y0 : y1) - pad;
+    box[2] = (x0 > x1 ? x0 : x1) + pad;
+    box[3] = (y0 > y1 ? y0 : y1) + pad;
+}
+
+bool boxes_overlap(const int a[4], const int b[4]) {
+    return a[0] <= b[2] && b[0] <= a[2] && a[1] <= b[3] && b[1] <= a[3];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Retained-mode widgets
+// Each dynamic field on a page is a widget that remembers the value it last drew.
+// Static chrome (label boxes, faces, units) is drawn by the display_*_chrome
+// functions, which tools/gen_backgrounds.c runs at build time to produce the
+// page backgrounds; page entry just draws the background. The display_*
+// functions then repaint only the widgets whose value changed since the
+// previous update.
+
+typedef enum {
+    W_SPEED,      // Speed value text
+    W_SPEED_BAR,  // Speed progress bar
+    W_GRAPH,      // Speed history graph (value is its scale)
+    W_GRAPH_LO,   // Graph scale, left end
+    W_GRAPH_HI,   // Graph scale, right end
+    W_LAT,        // Latitude text
+    W_LAT_DIR,    // N/S text
+    W_LON,        // Longitude text
+    W_LON_DIR,    // E/W text
+    W_NEEDLE,     // Compass needle
+    W_HOUR,       // Hours text
+    W_MIN,        // Minutes text
+    W_SEC,        // Seconds text
+    W_HANDS,      // Clock hands
+    W_SKY_SATS,   // Used / in view text
+    W_TRIP_DIST,  // Trip distance text
+    W_TRIP_TIME,  // Moving time text
+    W_TRIP_AVG,   // Average speed text
+    W_TRIP_MAX,   // Max speed text
+    W_ODOMETER,   // Odometer text
+    W_SKY_MARK,   // First of GPS_MAX_SATS sky plot markers, one per table slot
+    W_SKY_BAR = W_SKY_MARK + GPS_MAX_SATS,  // First of GPS_MAX_SATS SNR bars
+    WIDGET_COUNT = W_SKY_BAR + GPS_MAX_SATS
+} widget_id_t;
+
+typedef struct {
+    uint16_t x0, y0, x1, y1;  // Bounding box of the last paint (inclusive)
+    char last[16];            // Text last drawn (text widgets)
+    int32_t value;            // Value last drawn (graphic widgets)
+    bool drawn;               // False until painted after page entry
+} widget_t;
+
+widget_t widgets[WIDGET_COUNT];
+
+// Forget everything on screen so the next update repaints every widget
+// Call on page entry, after the chrome has been drawn
+void widgets_invalidate() {
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+        widgets[i].drawn = false;
+    }
+}
+
+// Record value for a widget; returns true if it differs from what is on screen
+// If previous is not NULL it receives the old value ("" if nothing was drawn yet)
+// While draw_cancel is set every widget reports "unchanged" and keeps its old value
+bool widget_update(widget_id_t id, const char* value, char* previous) {
+    widget_t* w = &widgets[id];
+    if (draw_cancel) return false;
+    if (w->drawn && strncmp(w->last, value, sizeof(w->last) - 1) == 0) {
+        return false;
+    }
+    if (previous) {
+        strcpy(previous, w->drawn ? w->last : "");
+    }
+    strncpy(w->last, value, sizeof(w->last) - 1);
+    w->last[sizeof(w->last) - 1] = '\0';
+    w->drawn = true;
+    return true;
+}
+
+// Numeric version of widget_update for graphic widgets (bars, hands, needles)
+// previous receives the old value, or WIDGET_NONE if nothing was drawn yet
+#define WIDGET_NONE INT32_MIN
+bool widget_update_value(widget_id_t id, int32_t value, int32_t* previous) {
+    widget_t* w = &widgets[id];
+    if (draw_cancel) return false;
+    if (w->drawn && w->value == value) {
+        return false;
+    }
+    if (previous) {
+        *previous = w->drawn ? w->value : WIDGET_NONE;
+    }
+    w->value = value;
+    w->drawn = true;
+    return true;
+}
+
+// Repaint a text widget at (x, y) if its value changed
+// The text is clipped to width pixels and the rest of the box is cleared to bg_color
+void widget_text(widget_id_t id, uint16_t x, uint16_t y, uint16_t width, const font_t* font,
+                 const char* value, uint16_t color, uint16_t bg_color) {
+    if (!widget_update(id, value, NULL)) return;
+
+    widget_t* w = &widgets[id];
+    w->x0 = x;
+    w->y0 = y;
+    w->x1 = x + width - 1;
+    w->y1 = y + font->height - 1;
+
+    size_t len = strlen(value);
+    tft_draw_text_clipped(x, y, font, value, len, width, color, bg_color);
+
+    // Clear whatever a longer previous value left behind
+    uint32_t text_end = x + font_text_width(font, len);
+    if (text_end <= w->x1) {
+        tft_draw_box(text_end, w->y0, w->x1, w->y1, bg_color);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Speed page chrome: blue label box, units and progress bar scale
+void display_speed_chrome(uint16_t x, uint16_t y, bool all) {
     uint16_t box_width = 220;
     uint16_t label_box_height = 30;
     uint16_t blue_color = RGB565(0, 0, 255);
-    
+
     // Draw blue box for label
     tft_draw_box(x, y, x + box_width - 1, y + label_box_height - 1, blue_color);
-    
+
     // Print "Speed:" label in the blue box
-    tft_print_string(x + 10, y + 8, "Speed:", RGB565(255, 255, 255), blue_color);
-    
-    // Print the speed value below the box
-    tft_print_string(x + 10, y + label_box_height + 10, speed_str, RGB565(0, 0, 0), RGB565(255, 255, 255));
+    tft_print_string(x + 10, y + 8, &font_medium, "Speed:", RGB565(255, 255, 255), blue_color);
 
     // Print Units
-    tft_print_string(x + 150, y + label_box_height + 10, "km/h", RGB565(0, 0, 0), RGB565(255, 255, 255));
+    tft_print_string(x + 150, y + label_box_height + 10, &font_medium, "km/h", RGB565(0, 0, 0), RGB565(255, 255, 255));
+
+    if(!all){
+        uint16_t progress_bar_y = y + label_box_height + 100;
+        uint16_t progress_bar_height = 15;
+        uint16_t progress_bar_x_start = x + 10;
+        uint16_t progress_bar_x_end = x + box_width - 11;
+        tft_print_string(progress_bar_x_start, progress_bar_y + progress_bar_height + 10, &font_medium, "0", RGB565(0, 0, 0), RGB565(255, 255, 255));
+        tft_print_string(progress_bar_x_end - 50, progress_bar_y + progress_bar_height + 10, &font_medium, "150", RGB565(0, 0, 0), RGB565(255, 255, 255));
+    }
+}
+
+#define MAX_SPEED 15000  // Full scale of the progress bar, km/h x 100
+
+// Progress bar color index for a speed: 0 = green, 1 = orange, 2 = red
+uint8_t speed_bar_level(uint32_t speed) {
+    if (speed * 100 > MAX_SPEED * 80) return 2;  // Above 80%
+    if (speed * 100 > MAX_SPEED * 60) return 1;  // Above 60%
+    return 0;
+}
+
+// Filled width of a progress bar of width pixels for a speed
+uint16_t speed_bar_fill(uint32_t speed, uint16_t width) {
+    if (speed > MAX_SPEED) speed = MAX_SPEED;  // Cap at 100%
+    return (uint16_t)(speed * width / MAX_SPEED);
+}
+
+// Draw the speed progress bar between x_start and x_end
+// The filled part and the empty remainder are each drawn once, so nothing is painted twice
+void draw_speed_bar(uint16_t x_start, uint16_t x_end, uint16_t y, uint16_t height, uint32_t speed) {
+    uint16_t progress_bar_width = x_end - x_start + 1;
+    uint16_t filled_width = speed_bar_fill(speed, progress_bar_width);
+
+    // Pick the fill color based on speed
+    const uint16_t level_colors[3] = {
+        RGB565(0, 255, 0),    // Green for normal speed
+        RGB565(255, 165, 0),  // Orange for medium-high
+        RGB565(255, 0, 0)     // Red for high speed
+    };
+    uint16_t progress_color = level_colors[speed_bar_level(speed)];
+
+    if (filled_width > 0) {
+        tft_draw_box(x_start, y, x_start + filled_width - 1, y + height - 1, progress_color);
+    }
+    // Empty part of the bar in light gray
+    if (filled_width < progress_bar_width) {
+        tft_draw_box(x_start + filled_width, y, x_end, y + height - 1, RGB565(200, 200, 200));
+    }
+}
+
+// Display Speed: [value] km/h in a blue box with progress bar
+// Parameters: x, y = position of top-left corner of the label box, 
+//             g = parsed GPS data, all = display mode
+// Only repaints the value and bar when they changed
+void display_speed(uint16_t x, uint16_t y, const gps_data* g, bool all) {
+    uint16_t box_width = 220;
+    uint16_t label_box_height = 30;
+    uint32_t speed = (g->valid & GPS_HAS_SPEED) ? g->speed : 0;
+
+    // Print the speed value below the box (up to the units), one decimal;
+    // big digits on the speed page, which has room down to the bar
+    char speed_str[16] = "";
+    if (g->valid & GPS_HAS_SPEED) {
+        snprintf(speed_str, sizeof(speed_str), "%lu.%lu", (unsigned long)(speed / 100), (unsigned long)(speed / 10 % 10));
+    }
+    const font_t* font = all ? &font_medium : &font_digits;
+    widget_text(W_SPEED, x + 10, y + label_box_height + 10, 140, font, speed_str, RGB565(0, 0, 0), RGB565(255, 255, 255));
 
     if(!all){
         // Progress bar dimensions
@@ -279,236 +824,589 @@ void display_speed(uint16_t x, uint16_t y, const char* speed_str, bool all) {
         uint16_t progress_bar_x_start = x + 10;
         uint16_t progress_bar_x_end = x + box_width - 11;
         uint16_t progress_bar_width = progress_bar_x_end - progress_bar_x_start + 1;
-        
-        // Draw progress bar background (empty bar in light gray)
-        tft_draw_box(progress_bar_x_start, progress_bar_y, progress_bar_x_end, progress_bar_y + progress_bar_height - 1, RGB565(200, 200, 200));
-        
-        int max_speed = 150;
 
-        // Calculate percentage filled (convert speed_str to float)
-        float current_speed = atof(speed_str);
-        float percentage = (current_speed / max_speed) * 100.0f;
-        if (percentage > 100.0f) percentage = 100.0f;  // Cap at 100%
-        if (percentage < 0.0f) percentage = 0.0f;      // Minimum 0%
-        
-        // Calculate filled width
-        uint16_t filled_width = (uint16_t)((percentage / 100.0f) * progress_bar_width);
-        
-        // Draw filled portion of progress bar in blue (or green/yellow/red based on speed)
-        uint16_t progress_color = blue_color;  // Default blue
-        if (percentage > 80.0f) {
-            progress_color = RGB565(255, 0, 0);  // Red for high speed
-        } else if (percentage > 60.0f) {
-            progress_color = RGB565(255, 165, 0);  // Orange for medium-high
-        } else {
-            progress_color = RGB565(0, 255, 0);  // Green for normal speed
+        // The bar only changes when its filled width or color does
+        int32_t bar = (speed_bar_fill(speed, progress_bar_width) << 2) | speed_bar_level(speed);
+        if (widget_update_value(W_SPEED_BAR, bar, NULL)) {
+            draw_speed_bar(progress_bar_x_start, progress_bar_x_end, progress_bar_y, progress_bar_height, speed);
         }
-        
-        if (filled_width > 0) {
-            tft_draw_box(progress_bar_x_start, progress_bar_y, 
-                        progress_bar_x_start + filled_width - 1, 
-                        progress_bar_y + progress_bar_height - 1, progress_color);
+    }
+}
+
+// Speed history graph (speed page, under the progress bar)
+// The bottom GRAPH_ROWS panel rows are the ILI9341 scrolling area. Time runs
+// down the screen, one row per second, and speed across. Sample k is always
+// drawn in area row k % GRAPH_ROWS and the scroll start puts the oldest
+// visible sample at the top, so a new sample costs one row (the oldest one,
+// which reappears at the bottom) and a 0x37 command. The scale is the visible
+// min..max rounded out to GRAPH_STEP; only a scale change repaints every row.
+#define GRAPH_ROWS SPEED_HISTORY_LEN
+#define GRAPH_TOP (TFT_HEIGHT - GRAPH_ROWS)  // First row of the scrolling area
+#define GRAPH_X0 10
+#define GRAPH_X1 229
+#define GRAPH_STEP 1000  // Scale rounding and grid spacing, km/h x 100
+
+uint32_t graph_drawn;  // History count when the graph rows were last brought up to date
+
+uint16_t graph_x(uint32_t speed, uint32_t lo, uint32_t hi) {
+    return GRAPH_X0 + (speed - lo) * (GRAPH_X1 - GRAPH_X0) / (hi - lo);
+}
+
+// One graph row: grid lines, then a bar out to sample k (none if k < 0)
+void graph_render_row(uint16_t* line, const speed_history_t* h, int32_t k, uint32_t lo, uint32_t hi) {
+    for (int x = 0; x < TFT_WIDTH; x++) line[x] = RGB565(255, 255, 255);
+    for (uint32_t v = lo; v <= hi; v += GRAPH_STEP) line[graph_x(v, lo, hi)] = RGB565(200, 200, 200);
+    if (k < 0) return;
+    uint16_t end = graph_x(speed_history_get(h, k), lo, hi);
+    for (int x = GRAPH_X0; x <= end; x++) line[x] = RGB565(0, 0, 255);
+}
+
+// Draw scrolling area rows r0..r1 for a history of count samples
+// Rows are rendered into the text strip and sent a band at a time
+void graph_draw_rows(const speed_history_t* h, uint32_t count, uint16_t r0, uint16_t r1, uint32_t lo, uint32_t hi) {
+    for (uint16_t r = r0; r <= r1; r += TEXT_STRIP_HEIGHT) {
+        uint16_t rows = r1 - r + 1 < TEXT_STRIP_HEIGHT ? r1 - r + 1 : TEXT_STRIP_HEIGHT;
+        spi_burst_wait();  // The previous band may still be streaming from the strip
+        for (uint16_t i = 0; i < rows; i++) {
+            // Sample held by this row: count - GRAPH_ROWS is in row count % GRAPH_ROWS
+            uint32_t age = (r + i + GRAPH_ROWS - count % GRAPH_ROWS) % GRAPH_ROWS;
+            graph_render_row(&text_strip[i * TFT_WIDTH], h, (int32_t)(count - GRAPH_ROWS + age), lo, hi);
         }
-        tft_print_string(progress_bar_x_start, progress_bar_y + progress_bar_height + 10, "0", RGB565(0, 0, 0), RGB565(255, 255, 255));
-        tft_print_string(progress_bar_x_end - 50, progress_bar_y + progress_bar_height + 10, "150", RGB565(0, 0, 0), RGB565(255, 255, 255));
+        if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+            fb_blit(0, GRAPH_TOP + r, TFT_WIDTH, rows, text_strip);
+            continue;
+        }
+        tft_set_window(0, GRAPH_TOP + r, TFT_WIDTH - 1, GRAPH_TOP + r + rows - 1);
+        spi_burst_write(text_strip, (uint32_t)TFT_WIDTH * rows, NULL);
     }
 }
 
-// Display Location: [lat, lon] in a red box
-// Parameters: x, y = position of top-left corner of the label box, lat_str = latitude string, lon_str = longitude string
-void display_location(uint16_t x, uint16_t y, const char* lat_str, const char* lat_dir, const char* lon_str, const char* lon_dir, bool all) {
-    uint16_t line_height = (FONT_HEIGHT * FONT_SCALE) + 4;
+// Bring the graph up to date with the history
+void display_speed_graph(const speed_history_t* h) {
+    if (draw_cancel) return;  // The new rows wait for the next draw of this page
+    uint32_t count = speed_history_count(h);
+    uint32_t first = count > GRAPH_ROWS ? count - GRAPH_ROWS : 0;
+
+    // Scale from the visible samples
+    uint32_t lo = count ? UINT32_MAX : 0, hi = 0;
+    for (uint32_t k = first; k < count; k++) {
+        uint32_t v = speed_history_get(h, k);
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    lo = lo / GRAPH_STEP * GRAPH_STEP;
+    hi = (hi + GRAPH_STEP - 1) / GRAPH_STEP * GRAPH_STEP;
+    if (hi == lo) hi = lo + GRAPH_STEP;
+
+    char text[16];
+    snprintf(text, sizeof(text), "%lu", (unsigned long)(lo / 100));
+    widget_text(W_GRAPH_LO, GRAPH_X0, GRAPH_TOP - 10, 40, &font_small, text, RGB565(0, 0, 0), RGB565(255, 255, 255));
+    snprintf(text, sizeof(text), "%3lu km/h", (unsigned long)(hi / 100));
+    uint16_t hi_x = GRAPH_X1 + 1 - font_text_width(&font_small, strlen(text));
+    widget_text(W_GRAPH_HI, hi_x, GRAPH_TOP - 10, GRAPH_X1 + 1 - hi_x, &font_small, text, RGB565(0, 0, 0), RGB565(255, 255, 255));
+
+    if (widget_update_value(W_GRAPH, (lo / GRAPH_STEP) << 16 | (hi / GRAPH_STEP), NULL)) {
+        // Page entry or a new scale
+        graph_draw_rows(h, count, 0, GRAPH_ROWS - 1, lo, hi);
+    } else if (graph_drawn != count) {
+        // Only the new samples' rows, in at most two runs around the wrap
+        uint32_t from = graph_drawn < first ? first : graph_drawn;
+        uint16_t r0 = from % GRAPH_ROWS, r1 = (count - 1) % GRAPH_ROWS;
+        if (r0 <= r1) {
+            graph_draw_rows(h, count, r0, r1, lo, hi);
+        } else {
+            graph_draw_rows(h, count, r0, GRAPH_ROWS - 1, lo, hi);
+            graph_draw_rows(h, count, 0, r1, lo, hi);
+        }
+    } else {
+        return;
+    }
+    graph_drawn = count;
+    tft_scroll_start(GRAPH_TOP + count % GRAPH_ROWS);
+}
+
+void draw_compass_letters();
+
+// Location page chrome: red label box, Lat/Lon labels and the compass face
+void display_location_chrome(uint16_t x, uint16_t y, bool all) {
+    uint16_t line_height = font_medium.height + 4;
     uint16_t box_width = 220;
     uint16_t label_box_height = 30;
     uint16_t red_color = RGB565(255, 0, 0);
-    
+
     // Draw red box for label
     tft_draw_box(x, y, x + box_width - 1, y + label_box_height - 1, red_color);
-    
+
     // Print "Location:" label in the red box
-    tft_print_string(x + 10, y + 8, "Location:", RGB565(255, 255, 255), red_color);
-    
-    // Print latitude below the box
-    tft_print_string(x + 10, y + label_box_height + 10, "Lat: ", RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 80, y + label_box_height + 10, lat_str, RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 200, y + label_box_height + 10, lat_dir, RGB565(0, 0, 0), RGB565(255, 255, 255));
-    
-    // Print longitude below latitude
-    tft_print_string(x + 10, y + label_box_height + 10 + line_height, "Lon: ", RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 80, y + label_box_height + 10 + line_height, lon_str, RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 200, y + label_box_height + 10 + line_height, lon_dir, RGB565(0, 0, 0), RGB565(255, 255, 255));
+    tft_print_string(x + 10, y + 8, &font_medium, "Location:", RGB565(255, 255, 255), red_color);
+
+    tft_print_string(x + 10, y + label_box_height + 10, &font_medium, "Lat: ", RGB565(0, 0, 0), RGB565(255, 255, 255));
+    tft_print_string(x + 10, y + label_box_height + 10 + line_height, &font_medium, "Lon: ", RGB565(0, 0, 0), RGB565(255, 255, 255));
 
     if(!all){
         // Print Compass Face
-        uint16_t compass_color = RGB565(150, 75, 0);
-        tft_draw_circle(120, 200, 80, compass_color);
-        tft_print_string(115, 130, "N", RGB565(0, 0, 0),compass_color);
-        tft_print_string(175, 195, "E", RGB565(0, 0, 0),compass_color);
-        tft_print_string(115, 260, "S", RGB565(0, 0, 0),compass_color);
-        tft_print_string(50, 195, "W", RGB565(0, 0, 0),compass_color);
-
-        // Print Direction Line
-        // Compass center is at (120, 200) with radius 80
-        int center_x = 120;
-        int center_y = 200;
-        int radius = 60;  // Line length from center
-        
-        int x_end = center_x;  // Initialize to center (fallback)
-        int y_end = center_y;  // Initialize to center (fallback)
-        
-        // Determine direction based on lat_dir and lon_dir strings
-        char lat_char = lat_dir[0];  // Get first character (N or S)
-        char lon_char = lon_dir[0];  // Get first character (E or W)
-        
-        if(lat_char == 'N' && lon_char == 'E'){
-            // North-East: x increases (east), y decreases (north)
-            x_end = center_x + radius - 10;
-            y_end = center_y - radius + 10;
-        }
-        else if(lat_char == 'N' && lon_char == 'W'){
-            // North-West: x decreases (west), y decreases (north)
-            x_end = center_x - radius + 10;
-            y_end = center_y - radius +10;
-        }
-        else if(lat_char == 'S' && lon_char == 'E'){
-            // South-East: x increases (east), y increases (south)
-            x_end = center_x + radius - 10;
-            y_end = center_y + radius - 10;
-        }
-        else if(lat_char == 'S' && lon_char == 'W'){
-            // South-West: x decreases (west), y increases (south)
-            x_end = center_x - radius + 10;
-            y_end = center_y + radius - 10;
-        }
-        else if(lat_char == 'N'){
-            // North only
-            x_end = center_x;
-            y_end = center_y - radius + 10;
-        }
-        else if(lat_char == 'S'){
-            // South only
-            x_end = center_x;
-            y_end = center_y + radius - 10;
-        }
-        else if(lon_char == 'E'){
-            // East only
-            x_end = center_x + radius - 10;
-            y_end = center_y;
-        }
-        else if(lon_char == 'W'){
-            // West only
-            x_end = center_x - radius + 10;
-            y_end = center_y;
+        tft_draw_circle(120, 200, 80, RGB565(150, 75, 0));
+        draw_compass_letters();
+    }
+}
+
+// Compass letters
+void draw_compass_letters() {
+    uint16_t compass_color = RGB565(150, 75, 0);
+    tft_print_string(115, 130, &font_medium, "N", RGB565(0, 0, 0),compass_color);
+    tft_print_string(175, 195, &font_medium, "E", RGB565(0, 0, 0),compass_color);
+    tft_print_string(115, 260, &font_medium, "S", RGB565(0, 0, 0),compass_color);
+    tft_print_string(50, 195, &font_medium, "W", RGB565(0, 0, 0),compass_color);
+}
+
+#define COMPASS_CX 120
+#define COMPASS_CY 200
+#define COMPASS_NEEDLE_WIDTH 6
+
+#define COMPASS_NEEDLE_LENGTH 55  // Stops short of the letters
+#define COMPASS_NEEDLE_MIN 8192    // Smoothed heading length (Q15) below which no needle is shown
+
+// Tip of the compass needle along the smoothed heading (east, north in Q15)
+// Returns false when the heading is too unsteady to point anywhere
+bool compass_needle_end(int32_t heading_x, int32_t heading_y, int* x, int* y) {
+    uint32_t length = isqrt32((uint32_t)(heading_x * heading_x) + (uint32_t)(heading_y * heading_y));
+    if (length < COMPASS_NEEDLE_MIN) return false;
+    // Scale to a unit vector times the needle length
+    *x = COMPASS_CX + (heading_x * COMPASS_NEEDLE_LENGTH * 2 + (int32_t)length) / (2 * (int32_t)length);
+    *y = COMPASS_CY - (heading_y * COMPASS_NEEDLE_LENGTH * 2 + (int32_t)length) / (2 * (int32_t)length);
+    return true;
+}
+
+// Draw the compass needle to the given tip
+void draw_compass_needle(int x_end, int y_end, uint16_t color) {
+    tft_draw_thick_line(COMPASS_CX, COMPASS_CY, x_end, y_end, COMPASS_NEEDLE_WIDTH, color);
+}
+
+// Format micro-degrees as unsigned decimal degrees in 7 characters
+// (4 decimals, or 3 when there are three degree digits)
+void format_degrees(char* buf, size_t size, int32_t micro) {
+    uint32_t a = micro < 0 ? -(uint32_t)micro : (uint32_t)micro;
+    uint32_t degrees = a / 1000000;
+    if (degrees < 100) {
+        snprintf(buf, size, "%lu.%04lu", (unsigned long)degrees, (unsigned long)(a % 1000000 / 100));
+    } else {
+        snprintf(buf, size, "%lu.%03lu", (unsigned long)degrees, (unsigned long)(a % 1000000 / 1000));
+    }
+}
+
+// Display Location: [lat, lon] in a red box
+// Parameters: x, y = position of top-left corner of the label box, g = parsed GPS data
+// Only repaints the fields (and needle) whose value changed
+void display_location(uint16_t x, uint16_t y, const gps_data* g, bool all) {
+    uint16_t line_height = font_medium.height + 4;
+    uint16_t label_box_height = 30;
+    uint16_t text_y = y + label_box_height + 10;
+
+    char lat_str[16] = "", lon_str[16] = "";
+    char lat_dir[2] = "", lon_dir[2] = "";
+    if (g->valid & GPS_HAS_POSITION) {
+        format_degrees(lat_str, sizeof(lat_str), g->latitude);
+        format_degrees(lon_str, sizeof(lon_str), g->longitude);
+        lat_dir[0] = g->latitude < 0 ? 'S' : 'N';
+        lon_dir[0] = g->longitude < 0 ? 'W' : 'E';
+    }
+
+    // Latitude and longitude values stop where the hemisphere letter starts
+    widget_text(W_LAT, x + 80, text_y, 120, &font_medium, lat_str, RGB565(0, 0, 0), RGB565(255, 255, 255));
+    widget_text(W_LAT_DIR, x + 200, text_y, TFT_WIDTH - (x + 200), &font_medium, lat_dir, RGB565(0, 0, 0), RGB565(255, 255, 255));
+    widget_text(W_LON, x + 80, text_y + line_height, 120, &font_medium, lon_str, RGB565(0, 0, 0), RGB565(255, 255, 255));
+    widget_text(W_LON_DIR, x + 200, text_y + line_height, TFT_WIDTH - (x + 200), &font_medium, lon_dir, RGB565(0, 0, 0), RGB565(255, 255, 255));
+
+    if(!all){
+        // Needle state is its tip, (x << 16) | y, or -1 with no needle
+        int x_end, y_end;
+        bool shown = (g->valid & GPS_HAS_COURSE) && compass_needle_end(g->heading_x, g->heading_y, &x_end, &y_end);
+        int32_t needle = shown ? (x_end << 16) | y_end : -1;
+        int32_t old_needle;
+        if (widget_update_value(W_NEEDLE, needle, &old_needle)) {
+            if (old_needle != WIDGET_NONE && old_needle != -1) {
+                // Erase the old needle by restoring the face (and letters) under it
+                int box[4];
+                thick_line_bounds(COMPASS_CX, COMPASS_CY, old_needle >> 16, old_needle & 0xFFFF, COMPASS_NEEDLE_WIDTH, box);
+                bg_restore(&bg_location, box[0], box[1], box[2], box[3]);
+            }
+            if (shown) draw_compass_needle(x_end, y_end, RGB565(255, 0, 0));
         }
-        
-        // Draw the direction line from center to calculated endpoint
-        tft_draw_thick_line(center_x, center_y, x_end, y_end, 6, red_color);
     }
 }
 
-// Display Time: [time_string] in a green box
-// Parameters: x, y = position of top-left corner of the label box, time_str = time string to display
-void display_time(uint16_t x, uint16_t y, const char* time_str, bool all) {
+void draw_clock_numerals();
+
+// Time page chrome: green label box, colons and the clock face
+void display_time_chrome(uint16_t x, uint16_t y, bool all) {
     uint16_t box_width = 220;
     uint16_t label_box_height = 30;
     uint16_t green_color = RGB565(0, 128, 0);
 
-    int center_x = 120;
-    int center_y = 200;
-    
     // Draw green box for label
     tft_draw_box(x, y, x + box_width - 1, y + label_box_height - 1, green_color);
-    
+
     // Print "Time:" label in the green box
-    tft_print_string(x + 10, y + 8, "Time:", RGB565(255, 255, 255), green_color);
-    
-    // Parse Time String (assumes format like "123456" or "12:34:56")
-    size_t num_substrings = 3;  // HH, MM, SS (not 5)
-    char** time_arr = (char**)malloc(num_substrings * sizeof(char*));
-    
-    // Allocate Memory for Parsed Times
-    for (size_t i = 0; i < num_substrings; ++i) {
-        time_arr[i] = (char*)malloc(3 * sizeof(char)); // 2 digits + null terminator
-        strncpy(time_arr[i], time_str + (i * 2), 2);
-        time_arr[i][2] = '\0'; // Null-terminate the substring
+    tft_print_string(x + 10, y + 8, &font_medium, "Time:", RGB565(255, 255, 255), green_color);
+
+    tft_print_string(x + 45, y + label_box_height + 10, &font_medium, ":", RGB565(0, 0, 0), RGB565(255, 255, 255));
+    tft_print_string(x + 95, y + label_box_height + 10, &font_medium, ":", RGB565(0, 0, 0), RGB565(255, 255, 255));
+
+    if(!all){
+        // Print Clock Face
+        tft_draw_circle(120, 200, 100, green_color);
+        draw_clock_numerals();
+    }
+}
+
+// Clock numerals and center dot
+void draw_clock_numerals() {
+    uint16_t green_color = RGB565(0, 128, 0);
+    tft_print_string(105, 105, &font_medium, "12", RGB565(255, 255, 255), green_color);
+    tft_print_string(155, 120, &font_medium, "1", RGB565(255, 255, 255), green_color);
+    tft_print_string(185, 155, &font_medium, "2", RGB565(255, 255, 255), green_color);
+    tft_print_string(200, 192, &font_medium, "3", RGB565(255, 255, 255), green_color);
+    tft_print_string(185, 229, &font_medium, "4", RGB565(255, 255, 255), green_color);
+    tft_print_string(155, 264, &font_medium, "5", RGB565(255, 255, 255), green_color);
+    tft_print_string(110, 280, &font_medium, "6", RGB565(255, 255, 255), green_color);
+    tft_print_string(65, 264, &font_medium, "7", RGB565(255, 255, 255), green_color);
+    tft_print_string(35, 229, &font_medium, "8", RGB565(255, 255, 255), green_color);
+    tft_print_string(25, 192, &font_medium, "9", RGB565(255, 255, 255), green_color);
+    tft_print_string(35, 155, &font_medium, "10", RGB565(255, 255, 255), green_color);
+    tft_print_string(65, 120, &font_medium, "11", RGB565(255, 255, 255), green_color);
+    tft_draw_circle(120, 200, 6, RGB565(255, 255, 255));
+}
+
+#define CLOCK_CX 120
+#define CLOCK_CY 200
+
+// One clock hand: tip and line width, drawn from the clock center
+typedef struct {
+    int x, y;
+    int width;
+    uint16_t color;
+} clock_hand_t;
+
+// The three clock hands for a UTC seconds-of-day value, in drawing order:
+// second hand at the bottom, then minute, then hour hand on top
+void clock_hands(uint32_t seconds, clock_hand_t hands[3]) {
+    int center_x = CLOCK_CX;
+    int center_y = CLOCK_CY;
+
+    int time_hour = seconds / 3600;
+    int time_min = seconds / 60 % 60;
+    int time_sec = seconds % 60;
+
+    // Binary angles clockwise from 12; the hour hand moves every minute
+    uint16_t hour_angle = ((time_hour % 12) * 60 + time_min) * 65536u / 720;
+    uint16_t min_angle = time_min * 65536u / 60;
+    uint16_t sec_angle = time_sec * 65536u / 60;
+
+    // Hand lengths: hour shortest, second longest
+    int hour_radius = 50;
+    int min_radius = 70;
+    int sec_radius = 85;
+
+    hands[0] = (clock_hand_t){ center_x + mul_q15(sec_radius, sin_q15(sec_angle)),
+                               center_y - mul_q15(sec_radius, cos_q15(sec_angle)), 3, RGB565(225, 225, 255) };
+    hands[1] = (clock_hand_t){ center_x + mul_q15(min_radius, sin_q15(min_angle)),
+                               center_y - mul_q15(min_radius, cos_q15(min_angle)), 4, RGB565(255, 255, 255) };
+    hands[2] = (clock_hand_t){ center_x + mul_q15(hour_radius, sin_q15(hour_angle)),
+                               center_y - mul_q15(hour_radius, cos_q15(hour_angle)), 4, RGB565(255, 255, 255) };
+}
+
+void draw_clock_hand(const clock_hand_t* hand) {
+    tft_draw_thick_line(CLOCK_CX, CLOCK_CY, hand->x, hand->y, hand->width, hand->color);
+}
+
+// Move the hands from old_seconds (WIDGET_NONE if not drawn) to seconds
+// Only hands that moved are erased, by restoring the face under them; a hand
+// is redrawn if it moved, if the face was restored under it, or if a hand
+// below it was redrawn across it
+void update_clock_hands(int32_t old_seconds, uint32_t seconds) {
+    clock_hand_t hands[3], old[3];
+    int boxes[3][4], restored[3][4];
+    int restored_count = 0;
+    bool redraw[3];
+
+    clock_hands(seconds, hands);
+    if (old_seconds != WIDGET_NONE) clock_hands(old_seconds, old);
+    for (int i = 0; i < 3; i++) {
+        thick_line_bounds(CLOCK_CX, CLOCK_CY, hands[i].x, hands[i].y, hands[i].width, boxes[i]);
+        redraw[i] = old_seconds == WIDGET_NONE || old[i].x != hands[i].x || old[i].y != hands[i].y;
+        if (redraw[i] && old_seconds != WIDGET_NONE) {
+            int* box = restored[restored_count++];
+            thick_line_bounds(CLOCK_CX, CLOCK_CY, old[i].x, old[i].y, old[i].width, box);
+            bg_restore(&bg_time, box[0], box[1], box[2], box[3]);
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < restored_count && !redraw[i]; j++) {
+            redraw[i] = boxes_overlap(boxes[i], restored[j]);
+        }
+        for (int j = 0; j < i && !redraw[i]; j++) {
+            redraw[i] = redraw[j] && boxes_overlap(boxes[i], boxes[j]);
+        }
+        if (redraw[i]) draw_clock_hand(&hands[i]);
+    }
+}
+
+// Display Time: [hh:mm:ss] in a green box
+// Parameters: x, y = position of top-left corner of the label box, g = parsed GPS data
+// Only repaints the fields (and hands) whose value changed
+void display_time(uint16_t x, uint16_t y, const gps_data* g, bool all) {
+    uint16_t label_box_height = 30;
+    uint16_t text_y = y + label_box_height + 10;
+    uint32_t seconds = (g->valid & GPS_HAS_TIME) ? g->time : 0;
+
+    // Split into two-digit fields; blank until the GPS reports a time
+    // (hours wrap at 24, so every field is exactly two digits)
+    char hms[3][3] = { "", "", "" };
+    if (g->valid & GPS_HAS_TIME) {
+        uint8_t fields[3] = { seconds / 3600 % 24, seconds / 60 % 60, seconds % 60 };
+        for (int i = 0; i < 3; i++) {
+            hms[i][0] = '0' + fields[i] / 10;
+            hms[i][1] = '0' + fields[i] % 10;
+            hms[i][2] = '\0';
+        }
     }
 
     // Print time string below the box
-    tft_print_string(x + 10, y + label_box_height + 10, time_arr[0], RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 45, y + label_box_height + 10, ":", RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 60, y + label_box_height + 10, time_arr[1], RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 95, y + label_box_height + 10,":", RGB565(0, 0, 0), RGB565(255, 255, 255));
-    tft_print_string(x + 110, y + label_box_height + 10, time_arr[2], RGB565(0, 0, 0), RGB565(255, 255, 255));
+    widget_text(W_HOUR, x + 10, text_y, 33, &font_medium, hms[0], RGB565(0, 0, 0), RGB565(255, 255, 255));
+    widget_text(W_MIN, x + 60, text_y, 33, &font_medium, hms[1], RGB565(0, 0, 0), RGB565(255, 255, 255));
+    widget_text(W_SEC, x + 110, text_y, 33, &font_medium, hms[2], RGB565(0, 0, 0), RGB565(255, 255, 255));
 
     if(!all){
-        // Print Clock Face
-        tft_draw_circle(center_x, center_y, 100, green_color);
-        tft_print_string(105, 105, "12", RGB565(255, 255, 255), green_color);
-        tft_print_string(155, 120, "1", RGB565(255, 255, 255), green_color);
-        tft_print_string(185, 155, "2", RGB565(255, 255, 255), green_color);
-        tft_print_string(200, 192, "3", RGB565(255, 255, 255), green_color);
-        tft_print_string(185, 229, "4", RGB565(255, 255, 255), green_color);
-        tft_print_string(155, 264, "5", RGB565(255, 255, 255), green_color);
-        tft_print_string(110, 280, "6", RGB565(255, 255, 255), green_color);
-        tft_print_string(65, 264, "7", RGB565(255, 255, 255), green_color);
-        tft_print_string(35, 229, "8", RGB565(255, 255, 255), green_color);
-        tft_print_string(25, 192, "9", RGB565(255, 255, 255), green_color);
-        tft_print_string(35, 155, "10", RGB565(255, 255, 255), green_color);
-        tft_print_string(65, 120, "11", RGB565(255, 255, 255), green_color);
-        tft_draw_circle(center_x, center_y, 6, RGB565(255, 255, 255));
-
-        // Print Clock Hands
-        int time_hour = atoi(time_arr[0]);
-        int time_min = atoi(time_arr[1]);
-        int time_sec = atoi(time_arr[2]);
-        
-        // Calculate angles in radians (need to use float/double, not int)
-        // Hour hand: 12-hour format, position based on hour + minute fraction
-        float hour_angle = ((time_hour % 12) * 30.0f + time_min * 0.5f) * (PI / 180.0f) - (PI / 2.0f);
-        // Minute hand: position based on minutes
-        float min_angle = (time_min * 6.0f) * (PI / 180.0f) - (PI / 2.0f);
-        
-        // Calculate hand endpoints (hour hand shorter, minute hand longer)
-        int hour_radius = 50;  // Hour hand length
-        int min_radius = 70;   // Minute hand length
-        
-        int x_hour = center_x + hour_radius * cosf(hour_angle);
-        int y_hour = center_y + hour_radius * sinf(hour_angle);
-        int x_min = center_x + min_radius * cosf(min_angle);
-        int y_min = center_y + min_radius * sinf(min_angle);
-        
-        // Calculate second hand angle (seconds * 6 degrees per second)
-        float sec_angle = (time_sec * 6.0f) * (PI / 180.0f) - (PI / 2.0f);
-        
-        // Calculate second hand endpoint (longest hand)
-        int sec_radius = 85;  // Second hand length (longer than minute hand)
-        int x_sec = center_x + sec_radius * cosf(sec_angle);
-        int y_sec = center_y + sec_radius * sinf(sec_angle);
-
-        // Draw clock hands with different thicknesses
-        int hour_hand_width = 4;  // Thicker hour hand
-        int min_hand_width = 4;   // Thinner minute hand
-        int sec_hand_width = 3;   // Thinnest second hand
-        
-        // Draw second hand first (longest, goes on bottom layer)
-        tft_draw_thick_line(center_x, center_y, x_sec, y_sec, sec_hand_width, RGB565(225, 225, 255)); 
-        
-        // Draw minute hand second
-        tft_draw_thick_line(center_x, center_y, x_min, y_min, min_hand_width, RGB565(255, 255, 255));
-        
-        // Draw hour hand third (so it appears on top)
-        tft_draw_thick_line(center_x, center_y, x_hour, y_hour, hour_hand_width, RGB565(255, 255, 255));
+        int32_t old_seconds;
+        if (widget_update_value(W_HANDS, seconds, &old_seconds)) {
+            update_clock_hands(old_seconds, seconds);
+        }
+    }
+}
+
+// Sky plot geometry: the horizon circle, with rings at 30 and 60 degrees elevation
+#define SKY_CX 120
+#define SKY_CY 152
+#define SKY_RADIUS 90
+#define SKY_MARK 3         // Marker half size (7x7 boxes)
+#define SKY_BAR_X 8        // First SNR bar
+#define SKY_BAR_PITCH 14   // Bar width plus gap
+#define SKY_BAR_WIDTH 12
+#define SKY_BAR_BASE 312   // Bottom row of the bars
+#define SKY_BAR_MAX 50     // SNR (dB-Hz) of a full height bar, 1 pixel per dB
+
+// Color of the plot background (disc, rings, cross) at (x, y)
+// Markers are erased by repainting this, so the grid under them comes back
+uint16_t sky_background(int x, int y) {
+    int dx = x - SKY_CX;
+    int dy = y - SKY_CY;
+    int d4 = 4 * (dx * dx + dy * dy);  // (2 * distance)^2, compared against (2r +- 1)^2
+    if (d4 >= (2 * SKY_RADIUS + 1) * (2 * SKY_RADIUS + 1)) return RGB565(255, 255, 255);
+    for (int r = SKY_RADIUS / 3; r <= SKY_RADIUS; r += SKY_RADIUS / 3) {
+        if (d4 >= (2 * r - 1) * (2 * r - 1) && d4 < (2 * r + 1) * (2 * r + 1)) return RGB565(128, 128, 128);
+    }
+    if (dx == 0 || dy == 0) return RGB565(128, 128, 128);
+    return RGB565(0, 0, 64);
+}
+
+// Repaint the plot background in a rectangle (inclusive)
+// Rows are built in the text strip and sent a band at a time
+void draw_sky_background(int x0, int y0, int x1, int y1) {
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= TFT_WIDTH) x1 = TFT_WIDTH - 1;
+    if (y1 >= TFT_HEIGHT) y1 = TFT_HEIGHT - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    uint16_t width = x1 - x0 + 1;
+    uint16_t band = sizeof(text_strip) / sizeof(text_strip[0]) / width;  // Rows per burst
+    for (int y = y0; y <= y1; y += band) {
+        uint16_t rows = y1 - y + 1 < band ? y1 - y + 1 : band;
+        spi_burst_wait();  // The previous band may still be streaming from the strip
+        for (uint16_t row = 0; row < rows; row++) {
+            for (uint16_t col = 0; col < width; col++) {
+                text_strip[row * width + col] = sky_background(x0 + col, y + row);
+            }
+        }
+        if (tft_target == TFT_TARGET_FRAMEBUFFER) {
+            fb_blit(x0, y, width, rows, text_strip);
+        } else {
+            tft_set_window(x0, y, x1, y + rows - 1);
+            spi_burst_write(text_strip, (uint32_t)width * rows, NULL);
+        }
+    }
+}
+
+// Sky page chrome: label box, the plot grid and the compass points around it
+void display_sky_chrome(uint16_t x, uint16_t y) {
+    uint16_t box_width = 220;
+    uint16_t label_box_height = 30;
+    uint16_t green_color = RGB565(0, 128, 0);
+
+    tft_draw_box(x, y, x + box_width - 1, y + label_box_height - 1, green_color);
+    tft_print_string(x + 10, y + 8, &font_medium, "Sats:", RGB565(255, 255, 255), green_color);
+
+    draw_sky_background(SKY_CX - SKY_RADIUS, SKY_CY - SKY_RADIUS, SKY_CX + SKY_RADIUS, SKY_CY + SKY_RADIUS);
+    uint16_t black = RGB565(0, 0, 0);
+    uint16_t white = RGB565(255, 255, 255);
+    tft_print_string(SKY_CX - 5, SKY_CY - SKY_RADIUS - 20, &font_medium, "N", black, white);
+    tft_print_string(SKY_CX - 5, SKY_CY + SKY_RADIUS + 4, &font_medium, "S", black, white);
+    tft_print_string(SKY_CX + SKY_RADIUS + 4, SKY_CY - 8, &font_medium, "E", black, white);
+    tft_print_string(SKY_CX - SKY_RADIUS - 19, SKY_CY - 8, &font_medium, "W", black, white);
+}
+
+// Marker / bar color: used in the fix, tracked, or only in view
+uint16_t sky_sat_color(const gps_sat_t* sat) {
+    if (sat->used) return RGB565(0, 255, 0);
+    if (sat->snr) return RGB565(255, 255, 0);
+    return RGB565(128, 128, 128);
+}
+
+// Screen position of a satellite: zenith at the center, horizon on the circle
+void sky_position(const gps_sat_t* sat, int* x, int* y) {
+    int32_t r = (90 - sat->elevation) * SKY_RADIUS;  // Pixels x 90
+    uint16_t a = ANGLE_FROM_DEGREES(sat->azimuth);
+    *x = SKY_CX + mul_q15(r, sin_q15(a)) / 90;
+    *y = SKY_CY - mul_q15(r, cos_q15(a)) / 90;
+}
+
+// Widget value of a marker: position and color class, 0 for an empty slot
+int32_t sky_mark_value(const gps_sat_t* sat) {
+    int x, y;
+    sky_position(sat, &x, &y);
+    uint8_t cls = sat->used ? 3 : sat->snr ? 2 : 1;
+    return (x << 16) | (y << 8) | cls;
+}
+
+// Display the satellite table as a sky plot with one SNR bar per satellite
+// Parameters: x, y = position of top-left corner of the label box, g = parsed GPS data
+// Only markers that moved or changed color and bars that changed are repainted
+void display_sky(uint16_t x, uint16_t y, const gps_data* g) {
+    uint16_t green_color = RGB565(0, 128, 0);
+    uint8_t count = (g->valid & GPS_HAS_SATS) ? g->sat_count : 0;
+
+    char text[16];
+    uint8_t used = 0;
+    for (uint8_t i = 0; i < count; i++) used += g->sats[i].used;
+    snprintf(text, sizeof(text), "%u/%u", used, count);
+    widget_text(W_SKY_SATS, x + 70, y + 8, 140, &font_medium, text, RGB565(255, 255, 255), green_color);
+
+    // Erase the markers that changed, remembering which slots need drawing
+    bool draw[GPS_MAX_SATS] = { false };
+    bool erased[GPS_MAX_SATS] = { false };
+    for (uint8_t i = 0; i < GPS_MAX_SATS; i++) {
+        int32_t value = i < count ? sky_mark_value(&g->sats[i]) : 0;
+        int32_t old;
+        if (!widget_update_value(W_SKY_MARK + i, value, &old)) continue;
+        draw[i] = value != 0;
+        if (old != WIDGET_NONE && old != 0) {
+            widget_t* w = &widgets[W_SKY_MARK + i];
+            draw_sky_background(w->x0, w->y0, w->x1, w->y1);
+            erased[i] = true;
+        }
+    }
+    // An unchanged marker overlapping an erased box lost some pixels; draw it again
+    for (uint8_t i = 0; i < count; i++) {
+        widget_t* w = &widgets[W_SKY_MARK + i];
+        for (uint8_t j = 0; j < GPS_MAX_SATS && !draw[i]; j++) {
+            widget_t* e = &widgets[W_SKY_MARK + j];
+            draw[i] = erased[j] && e->x0 <= w->x1 && w->x0 <= e->x1 && e->y0 <= w->y1 && w->y0 <= e->y1;
+        }
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (!draw[i]) continue;
+        widget_t* w = &widgets[W_SKY_MARK + i];
+        int mx = w->value >> 16;
+        int my = (w->value >> 8) & 0xFF;
+        w->x0 = mx - SKY_MARK;
+        w->y0 = my - SKY_MARK;
+        w->x1 = mx + SKY_MARK;
+        w->y1 = my + SKY_MARK;
+        tft_draw_box(w->x0, w->y0, w->x1, w->y1, sky_sat_color(&g->sats[i]));
+    }
+
+    // SNR bars, one per slot
+    for (uint8_t i = 0; i < GPS_MAX_SATS; i++) {
+        const gps_sat_t* sat = &g->sats[i];
+        uint16_t level = i < count ? (sat->snr > SKY_BAR_MAX ? SKY_BAR_MAX : sat->snr) : 0;
+        int32_t value = i < count ? ((level + 1) << 2 | (sat->used ? 2 : sat->snr ? 1 : 0)) : 0;
+        if (!widget_update_value(W_SKY_BAR + i, value, NULL)) continue;
+
+        uint16_t x0 = SKY_BAR_X + i * SKY_BAR_PITCH;
+        uint16_t x1 = x0 + SKY_BAR_WIDTH - 1;
+        uint16_t top = SKY_BAR_BASE - SKY_BAR_MAX;
+        uint16_t height = i < count ? level + 1 : 0;  // 1 pixel stub for an untracked satellite
+        if (height < SKY_BAR_MAX + 1) {
+            tft_draw_box(x0, top, x1, SKY_BAR_BASE - height, RGB565(255, 255, 255));
+        }
+        if (height) {
+            tft_draw_box(x0, SKY_BAR_BASE - height + 1, x1, SKY_BAR_BASE, sky_sat_color(sat));
+        }
     }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Trip page: one small label and one value per row below the label box
+#define TRIP_ROW_TOP 40  // First row label, from the top of the label box
+#define TRIP_ROW_PITCH 40
+
+static const char* const trip_labels[] = {
+    "Distance", "Moving time", "Average speed", "Max speed", "Odometer"
+};
+
+// Trip page chrome: label box and the row labels
+void display_trip_chrome(uint16_t x, uint16_t y) {
+    uint16_t box_width = 220;
+    uint16_t label_box_height = 30;
+    uint16_t purple_color = RGB565(128, 0, 128);
 
-    // Free Memory of Parsed Times
-    for (size_t i = 0; i < num_substrings; ++i) {
-        free(time_arr[i]);
+    tft_draw_box(x, y, x + box_width - 1, y + label_box_height - 1, purple_color);
+    tft_print_string(x + 10, y + 8, &font_medium, "Trip:", RGB565(255, 255, 255), purple_color);
+    for (int i = 0; i < 5; i++) {
+        tft_print_string(x + 10, y + TRIP_ROW_TOP + i * TRIP_ROW_PITCH, &font_small, trip_labels[i],
+                         RGB565(96, 96, 96), RGB565(255, 255, 255));
     }
-    free(time_arr);
 }
 
-void display_all(const char* speed_str, const char* lat_str, const char* lat_dir, const char* lon_str, const char* lon_dir, const char* time_str){
-    display_speed(10, 10, speed_str, 1); // Assuming max_speed is 100.0f for this example
-    display_location(10, 100, lat_str, lat_dir, lon_str, lon_dir, 1);
-    display_time(10, 210, time_str, 1);
+// Format km/h x 100 with one decimal
+static void trip_format_speed(char* out, size_t size, uint32_t speed) {
+    snprintf(out, size, "%lu.%lu km/h", (unsigned long)(speed / 100), (unsigned long)(speed / 10 % 10));
+}
+
+// Format metres as km with the given number of decimals (1 or 2)
+static void trip_format_km(char* out, size_t size, uint32_t meters, int decimals) {
+    uint32_t frac = decimals == 2 ? meters % 1000 / 10 : meters % 1000 / 100;
+    snprintf(out, size, decimals == 2 ? "%lu.%02lu km" : "%lu.%lu km", (unsigned long)(meters / 1000), (unsigned long)frac);
+}
+
+// Display the trip computer figures published with the fix
+// Parameters: x, y = position of top-left corner of the label box, g = parsed GPS data
+// Only repaints the rows whose text changed
+void display_trip(uint16_t x, uint16_t y, const gps_data* g) {
+    char text[5][20];
+    trip_format_km(text[0], sizeof(text[0]), g->trip_distance, 2);
+    snprintf(text[1], sizeof(text[1]), "%lu:%02lu:%02lu", (unsigned long)(g->trip_moving / 3600),
+             (unsigned long)(g->trip_moving / 60 % 60), (unsigned long)(g->trip_moving % 60));
+    trip_format_speed(text[2], sizeof(text[2]), g->trip_avg_speed);
+    trip_format_speed(text[3], sizeof(text[3]), g->trip_max_speed);
+    trip_format_km(text[4], sizeof(text[4]), g->odometer, 1);
+
+    for (int i = 0; i < 5; i++) {
+        widget_text(W_TRIP_DIST + i, x + 10, y + TRIP_ROW_TOP + 10 + i * TRIP_ROW_PITCH, 210, &font_medium, text[i],
+                    RGB565(0, 0, 0), RGB565(255, 255, 255));
+    }
+}
+
+// Chrome for the combined page
+void display_all_chrome(){
+    display_speed_chrome(10, 10, 1);
+    display_location_chrome(10, 100, 1);
+    display_time_chrome(10, 210, 1);
+}
+
+void display_all(const gps_data* g){
+    display_speed(10, 10, g, 1);
+    display_location(10, 100, g, 1);
+    display_time(10, 210, g, 1);
 }
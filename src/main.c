@@ -14,54 +14,136 @@
 #include "hardware/pwm.h"
 #include "hardware/spi.h"
 #include "hardware/uart.h"
+#include "hardware/sync.h"
+#include "hardware/flash.h"
 #include "pico/rand.h"
 #include "font.h"
+#include "nmea.h"
 #include "pico/time.h"
+#include "pico/multicore.h"
+#include "pico/flash.h"
+#include "pico/stdio_usb.h"
+#include "tusb.h"
+#include "track.h"
+#include "profile.h"
+#ifdef PICO_SIM
+#include "sim.h"  // Host simulation build (sim/)
+#endif
 /*Hardware mtk3339 Headers*/
-//#include "gpsdata.h"
+#include "gps.h"
+#include "gpsdata.h"
+#include "trig.h"
+#include "history.h"
+#include "trip.h"
+#include "kalman.h"
+#include "sched.h"
+#include "power.h"
+#include "background.h"
 #include "lcd.h"
 //////////////////////////////////////////////////////////////////////////////
 #define BUFSIZE 256
 char strbuf[BUFSIZE];
 #define PI 3.14159265358979323846
-
-typedef struct {
-    char ptmk[16];
-    char time[16];
-    char date[16];
-    char latitude[16];
-    char north_south[16];
-    char longitude[16];
-    char east_west[16];
-    char fix[16];
-    char num_sats[16];
-    char sat_id[16];
-    char sat_elev[16];
-    char sat_azimuth[16];
-    char ground_speed[16];
-    char ground_course[16];
-} gps_data;
-
+#define USE_FRAMEBUFFER 1  // Draw pages into the RAM framebuffer, then flush dirty tiles
+
+// Debug trace on stdio: SPI counters after every page draw and one line per
+// GPS sentence. That is 25 + 50 lines a second, and stdio_usb can block the
+// caller while a host is attached, so it is off unless built with
+// -DTRACE_ENABLED=1 (PROFILE and TASKS cover the timings at run time)
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0
+#endif
+
+// Latest fix, shared between cores through a seqlock
+// Core 0 (GPS) is the only writer and goes through gps_publish; core 1 and the
+// PWM interrupt read it with gps_snapshot. The writer makes gps_seq odd while
+// copying, so a reader that saw an odd or changed sequence simply copies again.
 gps_data gps;
+static volatile uint32_t gps_seq = 0;
+speed_history_t speed_history;  // One speed per second for the speed page graph
+nmea_parser_t gps_nmea;  // Streaming parser fed from the uart1 ring buffer
 // LCD Page Selection
 typedef enum{
     PAGE_SPEED = 0,
     PAGE_LOCATION = 1,
-    PAGE_TIME = 2
+    PAGE_TIME = 2,
+    PAGE_SKY = 3,
+    PAGE_TRIP = 4,
+    PAGE_ALL = 5,  // Speed, location and time together
+    PAGE_COUNT
 } page_t;
 
 //PWM Variables
 static int duty_cycle = 0; 
-static int dir = 0; 
-static int color = 0;
 
 
 // Current LCD Page
 volatile page_t current_page = PAGE_SPEED;
 
+// Task schedulers (see sched.h); each core runs its own from its main loop
+// and the interrupt handlers only post to them. Tasks in priority order.
+enum {
+    UI_TASK_PAGE,     // Page button pressed
+    UI_TASK_RENDER,   // Redraw the current page
+    UI_TASK_COUNT
+};
+enum {
+    IO_TASK_GPS,      // Parse what uart1 DMA received; PMTK queue timeouts
+    IO_TASK_LEDS,     // Speed on the LEDs
+    IO_TASK_USB,      // Host commands and track export
+    IO_TASK_POWER,    // Once a second: parked or moving
+    IO_TASK_COUNT
+};
+sched_t ui_sched;  // Core 1, TIMER0 alarm 1
+sched_t io_sched;  // Core 0, TIMER0 alarm 2
+
 /*Prevent Implicit Declarations*/
-void gps_periodic_irq();
+void gps_poll();
+void gps_cmd_ack(int type, int flag);
+bool gps_queue_command(const pmtk_command_t* cmd);
 void disp_page();
+void spi_dma_isr();
+
+// Profiled interrupt handlers and page draws (see profile.h)
+// PROF_DRAW_SPEED.. follow page_t order so disp_page can index by page
+enum {
+    PROF_PAGE_SEL_ISR,
+    PROF_LEDS,
+    PROF_UART_ISR,
+    PROF_DMA_ISR,
+    PROF_BACKGROUND,
+    PROF_DRAW_SPEED,
+    PROF_DRAW_LOCATION,
+    PROF_DRAW_TIME,
+    PROF_DRAW_SKY,
+    PROF_DRAW_TRIP,
+    PROF_DRAW_ALL,
+    PROF_FB_FLUSH,
+    PROF_COUNT
+};
+
+#if PROFILE_ENABLED
+static profile_t profiles[PROF_COUNT] = {
+    [PROF_PAGE_SEL_ISR] = {"page_sel_isr"},
+    [PROF_LEDS] = {"pwm_breathing"},
+    [PROF_UART_ISR] = {"gps_uart_isr"},
+    [PROF_DMA_ISR] = {"spi_dma_isr"},
+    [PROF_BACKGROUND] = {"page background"},
+    [PROF_DRAW_SPEED] = {"display_speed"},
+    [PROF_DRAW_LOCATION] = {"display_location"},
+    [PROF_DRAW_TIME] = {"display_time"},
+    [PROF_DRAW_SKY] = {"display_sky"},
+    [PROF_DRAW_TRIP] = {"display_trip"},
+    [PROF_DRAW_ALL] = {"display_all"},
+    [PROF_FB_FLUSH] = {"tft_fb_flush"},
+};
+#endif
+
+// Burst transfer state (see spi_burst_start)
+static int spi_dma_chan = -1;
+static uint16_t spi_fill_color;                 // DMA source for solid fills
+static volatile bool spi_burst_active = false;
+static spi_burst_cb_t spi_burst_done_cb = NULL;
 
 /*Init of all of the pins used */
 const int button_1 = 21;
@@ -86,15 +168,26 @@ const int DISP_RST = 15;
 // Initialize SPI interface for communication with TFT display
 // Sets up SPI pins and configures SPI0 at 10MHz
 void init_spi() {
-    uint pins[] = {SPI_SCK, SPI_CSn, SPI_TX, SPI_RX};
-    for(int i = 0; i<4; i++){
+    uint pins[] = {SPI_SCK, SPI_TX, SPI_RX};
+    for(int i = 0; i<3; i++){
         uint gpio = pins[i];
         gpio_init(gpio); // Initialize GPIO pin
         gpio_set_function(gpio, GPIO_FUNC_SPI); // Set pin to SPI function
 
     }
+    // CS is driven by software so it can stay asserted for a whole burst
+    gpio_init(SPI_CSn);
+    gpio_set_dir(SPI_CSn, true);
+    gpio_put(SPI_CSn, 1);
+
     spi_init(spi0, 1250000000); // Initialize SPI0 at 10MHz
     spi_set_format(spi0, 8, 0, 0, SPI_MSB_FIRST); // 8 bits per transfer, MSB first
+
+    // DMA channel used for burst pixel transfers
+    spi_dma_chan = dma_claim_unused_channel(true);
+    dma_channel_set_irq0_enabled(spi_dma_chan, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, spi_dma_isr);
+    irq_set_enabled(DMA_IRQ_0, true);
 }
 
 // Initialize display control pins (DC and RST)
@@ -112,20 +205,44 @@ void init_disp() {
 
 //////////////////////////////////////////////////////////////////////////////
 
+// SPI traffic counters, reset and reported around each page draw
+spi_stats_t spi_stats;
+
+// Clear the SPI traffic counters
+void spi_stats_reset() {
+    memset(&spi_stats, 0, sizeof(spi_stats));
+}
+
+// Print the SPI traffic counters accumulated since the last reset
+void spi_stats_report(const char* label) {
+    if (TRACE_ENABLED && spi_stats.transactions) {  // Redraws with nothing to repaint stay quiet
+        printf("%s: %lu SPI transactions, %lu bytes, %lu windows\n", label,
+               (unsigned long)spi_stats.transactions, (unsigned long)spi_stats.bytes,
+               (unsigned long)spi_stats.windows);
+    }
+#ifdef PICO_SIM
+    sim_frame_report(label, spi_stats.transactions, spi_stats.bytes, spi_stats.windows);
+#endif
+}
+
 // Send a command byte to the display
 // Sets DC pin low to indicate command mode, then sends the command
 void send_spi_cmd(spi_inst_t *spi, uint8_t cmd) {
+    spi_burst_wait();      // Let any pixel burst finish first
     gpio_put(DISP_DC, 0);  // Command mode (DC = 0)
     gpio_put(SPI_CSn, 0);  // Assert chip select (active low)
 
     spi_write_blocking(spi, &cmd, 1); // Send command byte
 
     gpio_put(SPI_CSn, 1);  // Deassert chip select
+    spi_stats.transactions++;
+    spi_stats.bytes += 1;
 }
 
 // Send a 16-bit (long) or 8-bit (not long) data value to the display (for colors and coordinates)
 // Converts 16-bit value to two bytes (MSB first) and sends them
 void send_spi_data16(spi_inst_t *spi, uint16_t data, bool is_long) {
+    spi_burst_wait();      // Let any pixel burst finish first
     gpio_put(DISP_DC, 1);  // Data mode (DC = 1)
     gpio_put(SPI_CSn, 0);  // Assert chip select (active low)
     if(is_long){
@@ -133,9 +250,92 @@ void send_spi_data16(spi_inst_t *spi, uint16_t data, bool is_long) {
         spi_write_blocking(spi, buf, 2); // Send both bytes
     }
     else{
-        spi_write_blocking(spi, &data, 1); // Send data byte
+        uint8_t byte = data & 0xFF;
+        spi_write_blocking(spi, &byte, 1); // Send data byte
     }
     gpio_put(SPI_CSn, 1);  // Deassert chip select
+    spi_stats.transactions++;
+    spi_stats.bytes += is_long ? 2 : 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Burst pixel transfers
+// A burst holds CS low for the whole pixel stream and switches spi0 to 16-bit
+// frames, so the DMA channel can feed RGB565 values straight into the TX FIFO.
+// The caller sets the window first; the next command waits for the burst to end.
+
+// Finish the active burst: drain the SPI, restore 8-bit frames and release CS
+// Called from the DMA interrupt or from spi_burst_wait, whichever runs first
+static void spi_burst_finish() {
+    uint32_t irq_state = save_and_disable_interrupts();
+    if (spi_burst_active) {
+        while (spi_is_busy(spi0));  // Last frames are still shifting out
+        while (spi_is_readable(spi0)) {
+            (void)spi_get_hw(spi0)->dr;  // Discard what was clocked in
+        }
+        spi_get_hw(spi0)->icr = SPI_SSPICR_RORIC_BITS;  // Clear RX overrun
+        spi_set_format(spi0, 8, 0, 0, SPI_MSB_FIRST);
+        gpio_put(SPI_CSn, 1);
+        spi_burst_active = false;
+
+        spi_burst_cb_t cb = spi_burst_done_cb;
+        spi_burst_done_cb = NULL;
+        if (cb) cb();
+    }
+    restore_interrupts(irq_state);
+}
+
+// DMA completion interrupt for burst transfers
+void spi_dma_isr() {
+    PROFILE_BEGIN(start);
+    dma_channel_acknowledge_irq0(spi_dma_chan);
+    spi_burst_finish();
+    PROFILE_END(profiles, PROF_DMA_ISR, start);
+}
+
+// Block until the active burst (if any) has completed
+void spi_burst_wait() {
+    if (!spi_burst_active) return;
+    dma_channel_wait_for_finish_blocking(spi_dma_chan);
+    spi_burst_finish();
+}
+
+// Start streaming count 16-bit pixels from src
+// increment = false repeats *src, which is how solid fills are sent
+static void spi_burst_start(const uint16_t* src, bool increment, uint32_t count, spi_burst_cb_t done) {
+    spi_burst_wait();
+    if (count == 0) {
+        if (done) done();
+        return;
+    }
+    gpio_put(DISP_DC, 1);  // Data mode (DC = 1)
+    gpio_put(SPI_CSn, 0);  // Held low until spi_burst_finish
+    spi_set_format(spi0, 16, 0, 0, SPI_MSB_FIRST);
+
+    dma_channel_config c = dma_channel_get_default_config(spi_dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, increment);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, spi_get_dreq(spi0, true));
+
+    spi_burst_done_cb = done;
+    spi_burst_active = true;
+    spi_stats.transactions++;
+    spi_stats.bytes += count * 2;
+    dma_channel_configure(spi_dma_chan, &c, &spi_get_hw(spi0)->dr, src, count, true);
+}
+
+// Send the same color count times (solid fills)
+void spi_burst_fill(uint16_t color, uint32_t count, spi_burst_cb_t done) {
+    spi_burst_wait();  // The previous fill may still be reading spi_fill_color
+    spi_fill_color = color;
+    spi_burst_start(&spi_fill_color, false, count, done);
+}
+
+// Send count pixels from a buffer; the buffer must stay valid until done runs
+void spi_burst_write(const uint16_t* pixels, uint32_t count, spi_burst_cb_t done) {
+    spi_burst_start(pixels, true, count, done);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -165,39 +365,184 @@ void tft_init() {
     send_spi_cmd(spi0, 0x36);
     send_spi_data16(spi0, 0x48, false);  // MX=1 (mirror X), RGB mode (BGR=0)
 
+    // Vertical scrolling area for the speed graph, starting unscrolled
+    tft_scroll_area(GRAPH_TOP, GRAPH_ROWS);
+    tft_send_scroll_start(GRAPH_TOP);
+
     // Display ON (0x29) - turn on the display
     send_spi_cmd(spi0, 0x29);
     sleep_ms(20);
 }
 
+// Panel power modes (kept out of lcd.h, which the host background
+// generator builds without the SDK timer functions)
+// Sleep in (0x10) stops the scan and the booster; memory is kept, so sleep
+// out (0x11) shows the last frame again. Either needs 5 ms before the next
+// command. Idle mode (0x39) shows only the top bit of each colour channel
+// and scans slower; 0x38 ends it.
+void tft_sleep(bool sleep) {
+    send_spi_cmd(spi0, sleep ? 0x10 : 0x11);
+    sleep_ms(5);
+}
+
+void tft_idle(bool idle) {
+    send_spi_cmd(spi0, idle ? 0x39 : 0x38);
+}
+
 // Helper to get a label for the current page 
 const char* get_page_label(void) {
     switch (current_page) {
         case PAGE_SPEED:    return "Speed Screen";
         case PAGE_LOCATION: return "Location Screen";
         case PAGE_TIME:     return "Time Screen";
+        case PAGE_SKY:      return "Sky Screen";
+        case PAGE_TRIP:     return "Trip Screen";
+        case PAGE_ALL:      return "All Screen";
         default:            return "Unknown";
     }
 }
-// TODO this will not actually work as the ISR will not allow for arguments to be made
-// As if this is a software-called function - FIX: seperate ISRs for each or look at how tis handled in lab
+// Page button input
+// Contact bounce shows up as a burst of edges around every press and release,
+// so both edges are watched and a rising edge (active high buttons) only
+// counts as a press when its pin had no edge for BUTTON_DEBOUNCE_US. Accepted
+// presses are queued for page_task and cancel the page being drawn, so a
+// slow page never delays the next one. Single producer (page_sel_isr) and
+// single consumer (page_task), so the queue needs no lock.
+#define BUTTON_DEBOUNCE_US 20000
+#define INPUT_QUEUE_SIZE 8  // Must be a power of two
+
+typedef enum {
+    INPUT_NEXT,  // button_1
+    INPUT_PREV,  // button_2
+    INPUT_COUNT
+} input_event_t;
+
+static volatile uint8_t input_queue[INPUT_QUEUE_SIZE];
+static volatile uint32_t input_head = 0;  // Next write, owned by page_sel_isr
+static volatile uint32_t input_tail = 0;  // Next read, owned by page_task
+static uint32_t button_edge_us[INPUT_COUNT];  // Last edge seen on each button
+
+// Handle the latched edges of one button
+static void button_edges(input_event_t ev, uint gpio, uint32_t now) {
+    uint32_t events = gpio_get_irq_event_mask(gpio);
+    if (!events) return;
+    gpio_acknowledge_irq(gpio, events);
+    bool quiet = now - button_edge_us[ev] >= BUTTON_DEBOUNCE_US;
+    button_edge_us[ev] = now;
+    if (!(events & GPIO_IRQ_EDGE_RISE) || !quiet) return;
+
+    uint32_t head = input_head;
+    if (head - input_tail >= INPUT_QUEUE_SIZE) return;  // Presses beyond a full queue are lost
+    input_queue[head & (INPUT_QUEUE_SIZE - 1)] = ev;
+    input_head = head + 1;
+    draw_cancel = true;
+    sched_post(&ui_sched, UI_TASK_PAGE);
+}
+
 void page_sel_isr() {
-   /*Set up code + global to change page state with different variables displayed*/
-   if (gpio_get_irq_event_mask(button_2) == GPIO_IRQ_EDGE_RISE)
-   {
-        gpio_acknowledge_irq(button_2, GPIO_IRQ_EDGE_RISE);
-        current_page = (current_page - 1) % 4;
-        disp_page();
-        printf("NEW PAGE SELECTED\n");
-   }
-   else
-   {
-        gpio_acknowledge_irq(button_1, GPIO_IRQ_EDGE_RISE);
-        current_page = (current_page + 1) % 4;
-        disp_page();
-        printf("NEW PAGE SELECTED\n");
-   }
-   
+   PROFILE_BEGIN(start);
+   uint32_t now = time_us_32();
+   button_edges(INPUT_NEXT, button_1, now);
+   button_edges(INPUT_PREV, button_2, now);
+   PROFILE_END(profiles, PROF_PAGE_SEL_ISR, start);
+}
+
+// Redraw rate; the retained widgets only repaint what changed, and speed and
+// position are extrapolated between fixes, so 25 Hz costs little
+#define SCREEN_PERIOD_US 40000
+#define SCREEN_STARTUP_US 1500000  // First redraw, once the panel has settled
+#define SCREEN_IDLE_PERIOD_US 1000000  // While the panel is idle or asleep
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Power management (see power.h)
+// Core 0 runs the state machine once a second and drives the GPS; core 1
+// follows power_state with the panel. Core 1 counts the presses it consumes
+// in input_presses, core 0 wakes the machine when the count moves and then
+// publishes the count it handled in power_presses_seen, after power_state.
+power_t power;  // Core 0
+volatile power_state_t power_state = POWER_AWAKE;
+volatile uint32_t input_presses = 0;
+volatile uint32_t power_presses_seen = 0;
+
+typedef enum {
+    PANEL_ON,
+    PANEL_IDLE,    // Idle mode: 8 colours, slow redraw
+    PANEL_ASLEEP   // Sleep in: nothing drawn
+} panel_mode_t;
+
+static panel_mode_t panel_mode = PANEL_ON;  // Core 1
+
+// What power_state asks of the panel, unless core 0 has yet to see a press
+static panel_mode_t panel_mode_wanted(void) {
+    uint32_t seen = power_presses_seen;
+    __dmb();  // power_state was written before the count that says it is current
+    if (seen != input_presses) return PANEL_ON;
+    switch (power_state) {
+        case POWER_AWAKE: return PANEL_ON;
+        case POWER_IDLE: return PANEL_IDLE;
+        default: return PANEL_ASLEEP;
+    }
+}
+
+static void panel_set_mode(panel_mode_t mode) {
+    if (mode == panel_mode) return;
+    if (panel_mode == PANEL_ASLEEP) tft_sleep(false);
+    if ((panel_mode == PANEL_IDLE) != (mode == PANEL_IDLE)) tft_idle(mode == PANEL_IDLE);
+    if (mode == PANEL_ASLEEP) tft_sleep(true);
+    panel_mode = mode;
+    ui_sched.tasks[UI_TASK_RENDER].period_us = mode == PANEL_ON ? SCREEN_PERIOD_US : SCREEN_IDLE_PERIOD_US;
+    if (mode == PANEL_ON) sched_timer(&ui_sched, UI_TASK_RENDER, SCREEN_PERIOD_US);
+}
+
+// Apply the queued presses and draw the page they lead to
+// A press on a sleeping panel only wakes it
+void page_task() {
+    draw_cancel = false;  // Before reading the queue: a press after this cancels again
+    bool waking = panel_mode == PANEL_ASLEEP;
+    uint32_t presses = 0;
+    while (input_tail != input_head) {
+        input_event_t ev = input_queue[input_tail & (INPUT_QUEUE_SIZE - 1)];
+        input_tail++;
+        presses++;
+        if (waking) continue;
+        if (ev == INPUT_NEXT) current_page = (current_page + 1) % PAGE_COUNT;
+        else current_page = (current_page + PAGE_COUNT - 1) % PAGE_COUNT;
+    }
+    if (!presses) return;
+    input_presses += presses;
+    panel_set_mode(PANEL_ON);
+    if (!waking) printf("NEW PAGE SELECTED\n");
+    disp_page();
+}
+
+// Render task: follow the power state, then redraw unless the panel sleeps
+void render_task() {
+    panel_set_mode(panel_mode_wanted());
+    if (panel_mode != PANEL_ASLEEP) disp_page();
+}
+
+// Power task: feed the state machine the latest fix and any presses, and put
+// the GPS in standby or wake it when the state asks for it
+void power_task() {
+    static uint32_t last_fix_ms = 0;
+    uint32_t presses = input_presses;
+    power_state_t before = power.state;
+    if (presses != power_presses_seen) {
+        power_wake(&power);
+    } else {
+        bool fix = gps.updated_ms != last_fix_ms;  // Core 0 writes gps, so no snapshot
+        bool moving = fix && (gps.valid & GPS_HAS_SPEED) && gps.speed >= TRIP_MOVING_SPEED;
+        power_tick(&power, moving, fix);
+    }
+    last_fix_ms = gps.updated_ms;
+    if ((before == POWER_STANDBY) != (power.state == POWER_STANDBY)) {
+        gps_queue_command(power.state == POWER_STANDBY ? &GPS_STANDBY : &GPS_TEST);
+    }
+    if (power.state != before) printf("POWER: %s\n", power_state_name(power.state));
+    power_state = power.state;
+    __dmb();
+    power_presses_seen = presses;
 }
 
 // Init all GPIO pins for page selection buttons 
@@ -206,119 +551,831 @@ void page_sel_init() {
     gpio_init(button_1);
 
     gpio_add_raw_irq_handler_masked((1u << button_2 | 1u << button_1), page_sel_isr);
-    gpio_set_irq_enabled(button_2,GPIO_IRQ_EDGE_RISE, true);
-    gpio_set_irq_enabled(button_1,GPIO_IRQ_EDGE_RISE, true);
+    gpio_set_irq_enabled(button_2, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true);
+    gpio_set_irq_enabled(button_1, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true);
     irq_set_enabled(IO_IRQ_BANK0, true);
 }
 
-uint32_t last_set_time = 0;
+//////////////////////////////////////////////////////////////////////////////
+
+// Track log in the upper half of the 16 MB W25Q128
+// The firmware image lives at the bottom of flash, so the top 8 MB are free.
+// Erase and program run through flash_safe_execute, which parks core 1 and
+// disables interrupts while XIP is unavailable; core 1 opts in at startup.
+#define TRACK_FLASH_OFFSET (8u * 1024 * 1024)
+#define TRACK_FLASH_SIZE (8u * 1024 * 1024)
+
+// Odometer store in the sectors just below the track log
+#define ODOMETER_FLASH_OFFSET (TRACK_FLASH_OFFSET - ODOMETER_SECTORS * TRACK_SECTOR_SIZE)
+#define ODOMETER_FLASH_SIZE (ODOMETER_SECTORS * TRACK_SECTOR_SIZE)
+
+track_log_t track_log;
+trip_t trip;
+
+typedef struct {
+    uint32_t offset;  // From the start of flash
+    const uint8_t* data;
+} flash_op_t;
 
-void timer_isr() {
-    /*Setting up timer leaving my code here for reference*/
-    timer0_hw->intr = 1u << 0;
-    last_set_time = timer0_hw->timerawl;
-    gps_periodic_irq();
-    timer0_hw->alarm[0] = timer0_hw->timerawl + 5000;
+static void flash_erase_locked(void* param) {
+    const flash_op_t* op = param;
+    flash_range_erase(op->offset, TRACK_SECTOR_SIZE);
+}
 
-    // fill in the code here to send ALL startup functions to the GPS
+static void flash_program_locked(void* param) {
+    const flash_op_t* op = param;
+    flash_range_program(op->offset, op->data, TRACK_PAGE_SIZE);
 }
 
-void screen_isr() {
-    /*Setting up timer leaving my code here for reference*/
-    timer0_hw->intr = 1u << 1;
-    last_set_time = timer0_hw->timerawl;
-    //tft_fill_screen(RGB565(255,255,255));
-    disp_page();
-    //page_sel_isr();
-    timer0_hw->alarm[1] = timer0_hw->timerawl + 2500000;   
-}
-
-void init_startup_timer() {
-    /*Setting up a timer, it wont be the exact same but it should be similar for startup stuff*/
-    timer0_hw->alarm[0] = 1E6;
-    timer0_hw->alarm[1] = 15E5;
-    irq_set_exclusive_handler(TIMER0_IRQ_0, timer_isr);
-    irq_set_exclusive_handler(TIMER0_IRQ_1, screen_isr);
-    timer0_hw->inte = 1u << 0;
-    timer0_hw->inte |= 1u << 1;
-    irq_set_enabled(TIMER0_IRQ_0, true);
-    irq_set_enabled(TIMER0_IRQ_1, true);
-}
-
-
-void gps_parser(char* message){
-    uint8_t i = 0;
-    uint8_t message_type = 0;
-    char *tokens[20];
-    const char delimiter[] = ",";
-    tokens[0] = strtok(message, delimiter);
-    while ((tokens[i] != NULL || i < 10))
-    {
-        i++;
-        if (i >= 20) break;
-        tokens[i] = strtok(NULL, delimiter);
+static void flash_erase_at(uint32_t offset) {
+    flash_op_t op = { offset, NULL };
+    int rc = flash_safe_execute(flash_erase_locked, &op, 100);
+    if (rc != PICO_OK) printf("Flash: erase at %lu failed (%d)\n", (unsigned long)offset, rc);
+}
+
+static void flash_program_at(uint32_t offset, const uint8_t* data) {
+    flash_op_t op = { offset, data };
+    int rc = flash_safe_execute(flash_program_locked, &op, 100);
+    if (rc != PICO_OK) printf("Flash: program at %lu failed (%d)\n", (unsigned long)offset, rc);
+}
+
+static void track_flash_read(uint32_t offset, void* out, uint32_t len) {
+    memcpy(out, (const void*)(XIP_BASE + TRACK_FLASH_OFFSET + offset), len);
+}
+
+static void track_flash_erase(uint32_t offset) {
+    flash_erase_at(TRACK_FLASH_OFFSET + offset);
+}
+
+static void track_flash_program(uint32_t offset, const uint8_t* data) {
+    flash_program_at(TRACK_FLASH_OFFSET + offset, data);
+#ifdef PICO_SIM
+    sim_track_program(offset, data);
+#endif
+}
+
+static const track_flash_t track_flash = {
+    TRACK_FLASH_SIZE, track_flash_read, track_flash_erase, track_flash_program
+};
+
+static void odometer_flash_read(uint32_t offset, void* out, uint32_t len) {
+    memcpy(out, (const void*)(XIP_BASE + ODOMETER_FLASH_OFFSET + offset), len);
+}
+
+static void odometer_flash_erase(uint32_t offset) {
+    flash_erase_at(ODOMETER_FLASH_OFFSET + offset);
+}
+
+static void odometer_flash_program(uint32_t offset, const uint8_t* data) {
+    flash_program_at(ODOMETER_FLASH_OFFSET + offset, data);
+}
+
+static const track_flash_t odometer_flash = {
+    ODOMETER_FLASH_SIZE, odometer_flash_read, odometer_flash_erase, odometer_flash_program
+};
+
+// Find the log left by the previous run
+void init_track() {
+    track_init(&track_log, &track_flash);
+    printf("Track: sectors %lu..%lu, resuming at page %u\n", (unsigned long)track_log.oldest,
+           (unsigned long)track_log.head, track_log.page);
+}
+
+// Load the odometer and start a new trip
+void init_trip() {
+    trip_init(&trip, &odometer_flash);
+    printf("Trip: odometer %lu m\n", (unsigned long)trip_odometer_m(&trip));
+}
+
+static bool trip_save_deferred = false;  // trip_save_queued is on the work queue
+
+// Write the odometer from the work queue rather than the GPS task; the first
+// entry of a used sector costs an erase (GPS bytes keep arriving by DMA)
+static void trip_save_queued(void* arg) {
+    (void)arg;
+    trip_save_deferred = false;
+    trip_save(&trip);
+}
+
+// Run the trip computer on a fix and copy its figures into the published data
+void trip_update_fix(gps_data* g) {
+    trip_update(&trip, g);
+    if (trip_save_due(&trip) && !trip_save_deferred) {
+        trip_save_deferred = sched_defer(&io_sched, trip_save_queued, NULL);
     }
-    
-    // OK, I can't use strcomp in the case function as it isnt constant
-    // I need to figure out a way that I can set this up to be a bitwise status int or smth. I think the solution is to have a
-    // Set of ints above here that 
+    g->trip_distance = trip_distance_m(&trip);
+    g->trip_moving = trip.moving_s;
+    g->trip_avg_speed = trip_avg_speed(&trip);
+    g->trip_max_speed = trip.max_speed;
+    g->odometer = trip_odometer_m(&trip);
+}
+
+// Sealed records waiting for track_log_queued
+// Logging a fix only queues its record; the append, which programs a page
+// every 16 records and now and then erases a sector, runs later as deferred
+// work so it never holds up parsing. Core 0 only, so no lock is needed.
+#define TRACK_QUEUE_SIZE 8  // Must be a power of two
+static track_record_t track_queue[TRACK_QUEUE_SIZE];
+static uint32_t track_queue_head = 0;
+static uint32_t track_queue_tail = 0;
+static bool track_queue_deferred = false;  // track_log_queued is on the work queue
+static uint32_t track_queue_dropped = 0;
+
+// Append the queued records to the log
+static void track_log_queued(void* arg) {
+    (void)arg;
+    track_queue_deferred = false;
+    while (track_queue_tail != track_queue_head) {
+        track_append(&track_log, &track_queue[track_queue_tail & (TRACK_QUEUE_SIZE - 1)]);
+        track_queue_tail++;
+    }
+}
+
+// Queue a published fix that carries a new position with a known date and time
+// Records collect in the page buffer, so flash is only touched once per 16 fixes
+void track_log_fix(const gps_data* g) {
+    uint8_t needed = GPS_HAS_POSITION | GPS_HAS_TIME | GPS_HAS_DATE;
+    if ((g->valid & needed) != needed || !(g->fresh & GPS_HAS_POSITION)) return;
+
+    track_record_t rec = {
+        .time = track_time(g->year, g->month, g->day, g->time),
+        .latitude = g->latitude,
+        .longitude = g->longitude,
+        .speed = g->speed > UINT16_MAX ? UINT16_MAX : g->speed,
+        .course = (uint32_t)g->course * 256 / 36000,
+    };
+    if (track_queue_head - track_queue_tail >= TRACK_QUEUE_SIZE) {
+        track_queue_dropped++;
+        return;
+    }
+    track_queue[track_queue_head & (TRACK_QUEUE_SIZE - 1)] = *track_seal(&rec);
+    track_queue_head++;
+    if (!track_queue_deferred) track_queue_deferred = sched_defer(&io_sched, track_log_queued, NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Track export over USB CDC
+// The host sends "EXPORT <index>\n" (index 0 = from the oldest record) and
+// the log is streamed as frames: a track_frame_t header followed by count raw
+// 16-byte record slots, read straight from XIP-mapped flash into the CDC FIFO.
+// A frame with type 'E' ends the export and carries the index to resume from.
+// Each poll only writes what fits in the FIFO, so a slow host throttles the
+// export instead of blocking the GPS loop. Console output over USB is paused
+// meanwhile so it cannot land inside a frame.
+// tools/track_receive.py is the matching host side.
+typedef struct {
+    char magic[3];    // "TRK"
+    char type;        // 'D' = records follow, 'E' = end of export
+    uint32_t index;   // Record index of the first slot (next index for 'E')
+    uint16_t count;   // Slots that follow
+    uint16_t reserved;
+} track_frame_t;
+
+static struct {
+    bool active;
+    uint32_t index;          // Next record index to export
+    track_frame_t frame;
+    const uint8_t* records;  // XIP address of the frame's slots
+    const uint8_t* data;     // Next byte to send (header or records)
+    uint32_t remaining;      // Bytes left in the header or records
+    bool in_records;         // The header is out, sending records
+    char line[24];           // Command being received
+    uint8_t line_len;
+} track_export;
+
+// Prepare the header of the next frame from the next programmed run of slots
+static void track_export_next_frame() {
+    uint32_t offset = 0;
+    uint32_t count = track_extent(&track_log, &track_export.index, &offset);
+    track_frame_t frame = { { 'T', 'R', 'K' }, count ? 'D' : 'E', track_export.index, count, 0 };
+    track_export.frame = frame;
+    track_export.records = (const uint8_t*)(XIP_BASE + TRACK_FLASH_OFFSET + offset);
+    track_export.data = (const uint8_t*)&track_export.frame;
+    track_export.remaining = sizeof(track_frame_t);
+    track_export.in_records = false;
+    track_export.index += count;
+}
+
+// Start streaming the log from record index
+void track_export_start(uint32_t index) {
+    track_log_queued(NULL);
+    track_sync(&track_log);  // Get buffered records into flash so they can be sent
+    stdio_set_driver_enabled(&stdio_usb, false);
+    track_export.active = true;
+    track_export.index = index;
+    track_export_next_frame();
+}
 
-    if (tokens[0] && strcmp(tokens[0],"$GPRMC") == 0)
-    {
-        message_type = 1;
+static void track_export_stop() {
+    track_export.active = false;
+    stdio_set_driver_enabled(&stdio_usb, true);
+}
+
+// Handle one command line from the host
+//   EXPORT n       send the track log from record n
+//   PROFILE        print handler and draw timings
+//   PROFILE RESET  clear them
+//   TRIP RESET     start a new trip (the odometer keeps counting)
+//   TASKS          print task run counts, times and missed deadlines
+//   POWER [s]      print the power state; with s, park after s seconds (0 = never)
+static void usb_command(const char* line) {
+    if (strncmp(line, "EXPORT", 6) == 0 && !track_export.active) {
+        track_export_start(strtoul(line + 6, NULL, 10));
+    }
+    else if (strcmp(line, "TRIP RESET") == 0) {
+        trip_reset(&trip);
+        printf("TRIP: reset\n");
+    }
+    else if (strcmp(line, "TASKS") == 0) {
+        sched_dump(&io_sched, "core 0");
+        sched_dump(&ui_sched, "core 1");
+        if (track_queue_dropped) printf("  %lu track records dropped\n", (unsigned long)track_queue_dropped);
     }
-    else if (tokens[0] && strcmp(tokens[0],"$GPVTG") == 0)
-    {
-        message_type = 2;
+    else if (strncmp(line, "POWER", 5) == 0) {
+        if (line[5] == ' ') power.park_s = strtoul(line + 6, NULL, 10);
+        printf("POWER: %s, parked %lu s, standby after %lu s\n", power_state_name(power.state),
+               (unsigned long)power.parked_s, (unsigned long)power.park_s);
     }
-    else if (tokens[0] && strcmp(tokens[0],"$GPGGA") == 0)
-    {
-        message_type = 3;
+    else if (strncmp(line, "PROFILE", 7) == 0) {
+#if PROFILE_ENABLED
+        if (strstr(line + 7, "RESET")) {
+            profile_reset(profiles, PROF_COUNT);
+        } else {
+            profile_dump(profiles, PROF_COUNT);
+        }
+#else
+        printf("PROFILE: built with PROFILE_ENABLED 0\n");
+#endif
     }
-    else
-    {
+}
+
+// Read host commands and move as much of the export as the CDC FIFO takes
+// Called from usb_task
+void track_export_poll() {
+    if (!tud_cdc_connected()) {
+        if (track_export.active) track_export_stop();
         return;
     }
-    if (tokens[0]) strcpy(gps.ptmk, tokens[0]);
+    while (tud_cdc_available()) {
+        char c = tud_cdc_read_char();
+        if (c == '\r' || c == '\n') {
+            track_export.line[track_export.line_len] = '\0';
+            if (track_export.line_len) usb_command(track_export.line);
+            track_export.line_len = 0;
+        } else if (track_export.line_len < sizeof(track_export.line) - 1) {
+            track_export.line[track_export.line_len++] = c;
+        }
+    }
+    if (!track_export.active) return;
+
+    uint32_t room;
+    while ((room = tud_cdc_write_available()) > 0) {
+        if (track_export.remaining == 0) {
+            if (track_export.frame.type == 'E') {
+                track_export_stop();
+                break;
+            }
+            if (!track_export.in_records) {
+                track_export.in_records = true;
+                track_export.data = track_export.records;
+                track_export.remaining = track_export.frame.count * sizeof(track_record_t);
+            } else {
+                track_export_next_frame();
+            }
+            continue;
+        }
+        uint32_t n = track_export.remaining < room ? track_export.remaining : room;
+        tud_cdc_write(track_export.data, n);
+        track_export.data += n;
+        track_export.remaining -= n;
+    }
+    tud_cdc_write_flush();
+}
 
-    
-    switch (message_type){
-        case 1: // GPRMC
-            if (tokens[7]) //strcpy(gps.ground_speed, tokens[7]);
-            if (tokens[8]) strcpy(gps.ground_course, tokens[8]);
+//////////////////////////////////////////////////////////////////////////////
+
+// Fields of the sentence being parsed; copied to gps only when its checksum matches
+static gps_data gps_pending;
+
+// $PMTK001 fields staged while the sentence is parsed (-1 = not read)
+// Type 0 is the PMTK000 test command, so the sentence itself is flagged apart
+static bool gps_ack = false;
+static int gps_ack_type = -1;
+static int gps_ack_flag = -1;
+
+// Satellite table assembled across the sentences of one GSV cycle
+// Published as gps.sats once the last message of the cycle arrives intact
+static gps_sat_t gps_sky[GPS_MAX_SATS];
+static uint8_t gps_sky_count = 0;
+static uint8_t gps_gsv_next = 0;   // Message number expected next, 0 = wait for message 1
+static uint8_t gps_gsv_total = 0;  // Messages in the current cycle
+static bool gps_gsv_skip = false;  // This sentence is out of sequence
+static int gps_gsv_slot = -1;      // gps_sky entry of the group being parsed
+
+// PRNs GSA lists as used in the fix (staged, then kept from the last good GSA)
+#define GSA_MAX_PRNS 12
+static uint8_t gps_gsa_staged[GSA_MAX_PRNS];
+static uint8_t gps_gsa_staged_count = 0;
+static uint8_t gps_used_prns[GSA_MAX_PRNS];
+static uint8_t gps_used_count = 0;
+
+// Set each satellite's used flag from the last GSA
+static void gps_mark_used(gps_sat_t* sats, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        sats[i].used = 0;
+        for (uint8_t j = 0; j < gps_used_count; j++) {
+            if (sats[i].prn == gps_used_prns[j]) sats[i].used = 1;
+        }
+    }
+}
+
+// Sort by PRN so a satellite keeps its slot (and its marker) between cycles
+static void gps_sort_sats(gps_sat_t* sats, uint8_t count) {
+    for (uint8_t i = 1; i < count; i++) {
+        gps_sat_t s = sats[i];
+        int j = i - 1;
+        while (j >= 0 && sats[j].prn > s.prn) {
+            sats[j + 1] = sats[j];
+            j--;
+        }
+        sats[j + 1] = s;
+    }
+}
+
+// Store a decoded field in gps_pending and flag it, or mark it missing
+static void gps_stage(bool ok, uint8_t bit) {
+    if (ok) {
+        gps_pending.valid |= bit;
+    } else {
+        gps_pending.valid &= ~bit;
+    }
+    gps_pending.fresh |= bit;
+}
+
+// Decode a hemisphere field; S and W make the staged coordinate negative
+static void gps_stage_hemisphere(int32_t* coord, const char* text, char negative) {
+    if (text[0] == negative && *coord > 0) *coord = -*coord;
+}
+
+// NMEA field callback: decode the fields we use straight into integers
+void gps_on_field(nmea_sentence_t type, uint8_t index, const char* text, uint8_t len) {
+    int32_t value;
+    if (index == 0) {
+        gps_pending = gps;  // Fields this sentence does not carry keep their value
+        gps_pending.fresh = 0;
+        gps_ack = type == NMEA_PMTK && strcmp(text, "PMTK001") == 0;
+        gps_ack_type = -1;
+        gps_gsv_skip = false;
+        gps_gsv_slot = -1;
+        gps_gsa_staged_count = 0;
+        return;
+    }
+    switch (type){
+        case NMEA_RMC:
+            if (index == 7) {
+                // Knots; VTG also reports km/h but RMC may be the only one enabled
+                bool ok = nmea_parse_fixed(text, 2, &value) && value >= 0;
+                if (ok) gps_pending.speed = (uint32_t)value * 1852 / 1000;
+                gps_stage(ok, GPS_HAS_SPEED);
+            }
+            if (index == 8) {
+                bool ok = nmea_parse_fixed(text, 2, &value) && value >= 0 && value < 36000;
+                if (ok) gps_pending.course = value;
+                gps_stage(ok, GPS_HAS_COURSE);
+            }
+            if (index == 9) {
+                gps_stage(nmea_parse_date(text, &gps_pending.day, &gps_pending.month, &gps_pending.year), GPS_HAS_DATE);
+            }
+            break;
+
+        case NMEA_VTG:
+            if (index == 1 && len > 0) {
+                bool ok = nmea_parse_fixed(text, 2, &value) && value >= 0 && value < 36000;
+                if (ok) gps_pending.course = value;
+                gps_stage(ok, GPS_HAS_COURSE);
+            }
+            if (index == 7) {
+                bool ok = nmea_parse_fixed(text, 2, &value) && value >= 0;  // km/h
+                if (ok) gps_pending.speed = value;
+                gps_stage(ok, GPS_HAS_SPEED);
+            }
+            break;
+
+        case NMEA_GGA:
+            if (index == 1) gps_stage(nmea_parse_time(text, &gps_pending.time), GPS_HAS_TIME);
+            if (index == 2) gps_stage(nmea_parse_coord(text, &gps_pending.latitude), GPS_HAS_POSITION);
+            if (index == 3) gps_stage_hemisphere(&gps_pending.latitude, text, 'S');
+            if (index == 4 && (gps_pending.valid & GPS_HAS_POSITION)) {
+                gps_stage(nmea_parse_coord(text, &gps_pending.longitude), GPS_HAS_POSITION);
+            }
+            if (index == 5) gps_stage_hemisphere(&gps_pending.longitude, text, 'W');
+            if (index == 6) {
+                bool ok = nmea_parse_fixed(text, 0, &value) && value >= 0;
+                gps_pending.fix = ok ? value : 0;
+                gps_stage(ok, GPS_HAS_FIX);
+                if (gps_pending.fix == 0) gps_pending.valid &= ~GPS_HAS_POSITION;
+            }
+            if (index == 7 && nmea_parse_fixed(text, 0, &value) && value >= 0) {
+                gps_pending.num_sats = value;
+            }
+            if (index == 8) {
+                bool ok = nmea_parse_fixed(text, 2, &value) && value > 0 && value <= UINT16_MAX;
+                gps_pending.hdop = ok ? value : 0;
+            }
+            break;
+
+        case NMEA_GSV:
+            // total, message number, in view, then (PRN, elevation, azimuth, SNR) x 4
+            if (index == 1 && nmea_parse_fixed(text, 0, &value)) gps_gsv_total = value;
+            if (index == 2) {
+                if (!nmea_parse_fixed(text, 0, &value)) value = 0;
+                if (value == 1) {
+                    gps_sky_count = 0;  // A new cycle starts
+                    gps_gsv_next = 1;
+                }
+                gps_gsv_skip = value == 0 || value != gps_gsv_next;
+            }
+            if (index < 4 || gps_gsv_skip) break;
+            if ((index - 4) % 4 == 0) {
+                gps_gsv_slot = -1;
+                if (gps_sky_count < GPS_MAX_SATS && nmea_parse_fixed(text, 0, &value) && value > 0) {
+                    gps_gsv_slot = gps_sky_count++;
+                    memset(&gps_sky[gps_gsv_slot], 0, sizeof(gps_sat_t));
+                    gps_sky[gps_gsv_slot].prn = value;
+                }
+            }
+            else if (gps_gsv_slot >= 0 && nmea_parse_fixed(text, 0, &value) && value >= 0) {
+                gps_sat_t* sat = &gps_sky[gps_gsv_slot];
+                switch ((index - 4) % 4) {
+                    case 1: if (value <= 90) sat->elevation = value; break;
+                    case 2: if (value < 360) sat->azimuth = value; break;
+                    case 3: sat->snr = value > 99 ? 99 : value; break;  // Empty while not tracked
+                }
+            }
             break;
 
-        case 2: // GPVTG
-            if (tokens[6]) strcpy(gps.ground_speed, tokens[6]);
-            if (tokens[1]) strcpy(gps.ground_course, tokens[1]);
+        case NMEA_GSA:
+            // mode, fix type, then up to 12 PRNs used in the fix
+            if (index >= 3 && index < 3 + GSA_MAX_PRNS && nmea_parse_fixed(text, 0, &value) && value > 0) {
+                gps_gsa_staged[gps_gsa_staged_count++] = value;
+            }
             break;
 
-        case 3: // GPGGA
-            if (tokens[1]) strcpy(gps.time, tokens[1]);
-            if (tokens[2]) strcpy(gps.latitude, tokens[2]); 
-            if (tokens[3]) strcpy(gps.north_south, tokens[3]);
-            if (tokens[4]) strcpy(gps.longitude, tokens[4]);
-            if (tokens[5]) strcpy(gps.east_west, tokens[5]);
-            if (tokens[6]) strcpy(gps.fix, tokens[6]);
-            if (tokens[7]) strcpy(gps.num_sats, tokens[7]);
+        case NMEA_PMTK:
+            // $PMTK001,<type>,<flag>
+            if (!gps_ack) break;
+            if (index == 1 && nmea_parse_fixed(text, 0, &value)) gps_ack_type = value;
+            if (index == 2 && nmea_parse_fixed(text, 0, &value)) gps_ack_flag = value;
             break;
 
         default:
             break;
     }
+}
 
+// Replace the shared fix (core 0 only)
+// Interrupts stay off so a reader on this core can never spin on a half-written copy
+void gps_publish(const gps_data* g) {
+    uint32_t irq_state = save_and_disable_interrupts();
+    gps_seq++;  // Odd: update in progress
+    __dmb();
+    gps = *g;
+    __dmb();
+    gps_seq++;  // Even: consistent again
+    restore_interrupts(irq_state);
 }
 
+// Copy a consistent snapshot of the shared fix (any core, any context)
+void gps_snapshot(gps_data* out) {
+    uint32_t seq;
+    do {
+        seq = gps_seq;
+        __dmb();
+        *out = gps;
+        __dmb();
+    } while ((seq & 1) || seq != gps_seq);
+}
 
-void init_uart_gps() {
-    uart_init(uart1, 9600);
-    gpio_set_function(UART_TX_PIN, UART_FUNCSEL_NUM(uart1, 0)); // TODO: double check naming of TX and RX PINS
-    gpio_set_function(UART_RX_PIN, UART_FUNCSEL_NUM(uart1, 1)); // TODO: double check naming of TX and RX PINS
-    uart_set_format(uart1, 8, 1, UART_PARITY_NONE);
-    sleep_ms(1);
-    uart_write_blocking(uart1, (const uint8_t*) "$PMTK104*37\r\n", strlen("$PMTK104*37\r\n"));
-    uart_write_blocking(uart1,(const uint8_t*) "$PMTK314,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*2C\r\n", strlen("$PMTK314,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0*2C<CR><LF>"));
-    /* BITWISE DEFINITION OF OUTPUT 
+// Fold a fresh course into the smoothed heading vector
+// Averaging unit vectors instead of angles keeps 359 and 1 degrees from
+// averaging to 180. Below HEADING_MIN_SPEED the course is mostly noise and
+// is left out.
+#define HEADING_MIN_SPEED 200  // km/h x 100
+#define HEADING_SMOOTH_SHIFT 2  // Each course moves the vector 1/4 of the way
+static void gps_smooth_heading(gps_data* g) {
+    if (!(g->fresh & GPS_HAS_COURSE) || !(g->valid & GPS_HAS_COURSE)) return;
+    if (!(g->valid & GPS_HAS_SPEED) || g->speed < HEADING_MIN_SPEED) return;
+    uint16_t angle = ANGLE_FROM_CENTIDEGREES(g->course);
+    g->heading_x += (sin_q15(angle) - g->heading_x) >> HEADING_SMOOTH_SHIFT;
+    g->heading_y += (cos_q15(angle) - g->heading_y) >> HEADING_SMOOTH_SHIFT;
+}
+
+// Motion filter between fixes (see kalman.h); zero = not running
+static kalman_t gps_kalman;
+
+// Feed the sentence to the filter and publish its estimate with the fix
+static void gps_filter_motion(gps_data* g, nmea_sentence_t type) {
+    kalman_update(&gps_kalman, g, type == NMEA_RMC);  // VTG repeats RMC's velocity
+    if (kalman_motion(&gps_kalman, &g->motion)) {
+        g->valid |= GPS_HAS_MOTION;
+    } else {
+        g->valid &= ~GPS_HAS_MOTION;
+    }
+}
+
+// Replace speed and position with the filter's estimate for now_ms, so the
+// display and LEDs move smoothly between 1 Hz fixes
+static void gps_apply_motion(gps_data* g, uint32_t now_ms) {
+    if (!(g->valid & GPS_HAS_MOTION)) return;
+    if (g->valid & GPS_HAS_SPEED) g->speed = kalman_speed_at(&g->motion, now_ms);
+    if (g->valid & GPS_HAS_POSITION) kalman_position_at(&g->motion, now_ms, &g->latitude, &g->longitude);
+}
+
+// One history sample per UTC second, taken when a sentence brings a new time
+static void gps_sample_history(const gps_data* g) {
+    static uint32_t last_time = UINT32_MAX;
+    if (!(g->fresh & GPS_HAS_TIME) || !(g->valid & GPS_HAS_TIME) || g->time == last_time) return;
+    last_time = g->time;
+    speed_history_push(&speed_history, (g->valid & GPS_HAS_SPEED) ? g->speed : 0);
+}
+
+// NMEA sentence callback: commit the staged fields of a valid sentence
+void gps_on_sentence(nmea_sentence_t type, bool valid) {
+    if (type == NMEA_GSV && (!valid || gps_gsv_skip)) {
+        gps_gsv_next = 0;  // Lost part of the cycle; wait for the next one
+        return;
+    }
+    if (!valid || type == NMEA_UNKNOWN) return;
+    if (type == NMEA_PMTK) {
+        if (gps_ack && gps_ack_type >= 0) gps_cmd_ack(gps_ack_type, gps_ack_flag);
+        return;
+    }
+    if (type == NMEA_GSV) {
+        if (gps_gsv_next++ < gps_gsv_total) return;  // More messages to come
+        gps_gsv_next = 0;
+        gps_mark_used(gps_sky, gps_sky_count);
+        gps_sort_sats(gps_sky, gps_sky_count);
+        memcpy(gps_pending.sats, gps_sky, sizeof(gps_sky));
+        gps_pending.sat_count = gps_sky_count;
+        gps_stage(true, GPS_HAS_SATS);
+    }
+    if (type == NMEA_GSA) {
+        memcpy(gps_used_prns, gps_gsa_staged, gps_gsa_staged_count);
+        gps_used_count = gps_gsa_staged_count;
+        gps_mark_used(gps_pending.sats, gps_pending.sat_count);
+        gps_pending.fresh |= GPS_HAS_SATS;
+    }
+    gps_smooth_heading(&gps_pending);
+    trip_update_fix(&gps_pending);
+    gps_pending.updated_ms = to_ms_since_boot(get_absolute_time());
+    gps_filter_motion(&gps_pending, type);
+    gps_publish(&gps_pending);
+    gps_sample_history(&gps_pending);
+    track_log_fix(&gps_pending);
+    if (TRACE_ENABLED) {
+        printf("Time: %lu, Type: %d, Speed: %lu, Lat: %ld, Lon: %ld, Fix: %u, Sats: %u\n",
+               (unsigned long)gps.time, type, (unsigned long)gps.speed, (long)gps.latitude,
+               (long)gps.longitude, gps.fix, gps.num_sats);
+    }
+}
+
+// GPS receive ring buffer
+// A DMA channel paced by uart1's RX DREQ copies every byte in here, so bytes
+// keep arriving while both cores are held off flash for an erase (45 ms, or
+// about 500 bytes at 115200 baud, against a 32 byte FIFO). The GPS task polls
+// how far the channel got and frames sentences from there.
+// The channel counts down from GPS_RX_DMA_COUNT, so the bytes received so far
+// follow from its transfer count; a reader that fell more than a whole ring
+// behind has lost the difference.
+#define GPS_RX_BUFSIZE 4096  // Must be a power of two (~350 ms at 115200 baud)
+#define GPS_RX_RING_BITS 12  // log2(GPS_RX_BUFSIZE); the write address wraps here
+#define GPS_RX_DMA_COUNT 0x0FFFFFFFu  // Largest RP2350 transfer count; restarted at half
+#define GPS_POLL_US 20000    // GPS task period
+static uint8_t gps_rx_buf[GPS_RX_BUFSIZE] __attribute__((aligned(GPS_RX_BUFSIZE)));
+static int gps_rx_dma;
+static uint32_t gps_rx_base = 0;     // Bytes received before the current DMA run
+static uint32_t gps_rx_tail = 0;     // Bytes read by gps_poll
+static uint32_t gps_rx_dropped = 0;  // Bytes overwritten before gps_poll read them
+
+// Bytes received since boot
+static uint32_t gps_rx_head() {
+    return gps_rx_base + (GPS_RX_DMA_COUNT - (dma_channel_hw_addr(gps_rx_dma)->transfer_count & GPS_RX_DMA_COUNT));
+}
+
+// Start a DMA run that carries on at the ring position of received
+static void gps_rx_dma_start(uint32_t received) {
+    gps_rx_base = received;
+    dma_channel_set_write_addr(gps_rx_dma, &gps_rx_buf[received & (GPS_RX_BUFSIZE - 1)], false);
+    dma_channel_set_trans_count(gps_rx_dma, GPS_RX_DMA_COUNT, true);
+}
+
+static void gps_rx_init() {
+    gps_rx_dma = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(gps_rx_dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, GPS_RX_RING_BITS);
+    channel_config_set_dreq(&c, uart_get_dreq_num(uart1, false));
+    dma_channel_configure(gps_rx_dma, &c, gps_rx_buf, &uart_get_hw(uart1)->dr, 0, false);
+    gps_rx_dma_start(0);
+}
+
+// Frame being sent by the uart1 TX interrupt
+static char gps_tx_frame[80];
+static volatile uint8_t gps_tx_len = 0;
+static volatile uint8_t gps_tx_pos = 0;
+
+// Move as much of the frame into the TX FIFO as fits
+// The TX interrupt stays enabled only while bytes remain
+static void gps_tx_fill() {
+    while (gps_tx_pos < gps_tx_len && uart_is_writable(uart1)) {
+        uart_putc_raw(uart1, gps_tx_frame[gps_tx_pos++]);
+    }
+    uart_set_irq_enables(uart1, false, gps_tx_pos < gps_tx_len);
+}
+
+// uart1 interrupt: refill the TX FIFO (RX goes through DMA)
+void gps_uart_isr() {
+    PROFILE_BEGIN(start);
+    if (gps_tx_pos < gps_tx_len) {
+        gps_tx_fill();
+    }
+    PROFILE_END(profiles, PROF_UART_ISR, start);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// PMTK command queue
+// Commands from gps.h are sent one at a time by the uart1 TX interrupt, so
+// queueing never blocks. A command that the module acknowledges stays at the
+// head of the queue until the matching $PMTK001 arrives, and is resent if it
+// does not arrive in time. gps_cmd_poll drives the queue from the GPS task.
+#define PMTK_QUEUE_SIZE 8
+#define PMTK_ACK_TIMEOUT_MS 1000
+#define PMTK_MAX_TRIES 3
+
+typedef enum {
+    PMTK_QUEUED,     // Waiting to be sent
+    PMTK_SENT,       // Being sent, or waiting for its ACK
+    PMTK_ACCEPTED,   // ACK flag 3 (succeeded)
+    PMTK_REJECTED,   // ACK with any other flag
+    PMTK_TIMED_OUT,  // No ACK after PMTK_MAX_TRIES sends
+    PMTK_UNACKED     // Sent; the module does not acknowledge this command
+} pmtk_state_t;
+
+typedef struct {
+    const pmtk_command_t* cmd;
+    pmtk_state_t state;
+    uint8_t tries;
+    uint32_t sent_ms;
+} pmtk_slot_t;
+
+static pmtk_slot_t pmtk_queue[PMTK_QUEUE_SIZE];
+static uint8_t pmtk_head = 0;   // Slot of the command being sent
+static uint8_t pmtk_count = 0;  // Commands queued, including the head
+
+// Add a command to the queue; false if the queue is full
+bool gps_queue_command(const pmtk_command_t* cmd) {
+    if (pmtk_count == PMTK_QUEUE_SIZE) return false;
+    pmtk_slot_t* slot = &pmtk_queue[(pmtk_head + pmtk_count) % PMTK_QUEUE_SIZE];
+    slot->cmd = cmd;
+    slot->state = PMTK_QUEUED;
+    slot->tries = 0;
+    pmtk_count++;
+    return true;
+}
+
+// True once every queued command has been sent and answered (or given up on)
+bool gps_cmd_idle() {
+    return pmtk_count == 0;
+}
+
+// Record how the head command ended and move on to the next one
+static void gps_cmd_finish(pmtk_state_t result) {
+    static const char* const names[] = {
+        [PMTK_ACCEPTED] = "accepted", [PMTK_REJECTED] = "rejected",
+        [PMTK_TIMED_OUT] = "no ACK", [PMTK_UNACKED] = "sent"
+    };
+    pmtk_slot_t* slot = &pmtk_queue[pmtk_head];
+    slot->state = result;
+    printf("GPS: $%s %s (%u tries)\n", slot->cmd->body, names[result], slot->tries);
+    pmtk_head = (pmtk_head + 1) % PMTK_QUEUE_SIZE;
+    pmtk_count--;
+}
+
+// Handle a $PMTK001 acknowledgement for the head command
+void gps_cmd_ack(int type, int flag) {
+    if (pmtk_count == 0) return;
+    pmtk_slot_t* slot = &pmtk_queue[pmtk_head];
+    if (slot->state != PMTK_SENT || slot->cmd->type != type) return;
+    gps_cmd_finish(flag == PMTK_ACK_SUCCEEDED ? PMTK_ACCEPTED : PMTK_REJECTED);
+}
+
+// Start sending the head command, complete unacknowledged ones and resend on timeout
+void gps_cmd_poll() {
+    if (pmtk_count == 0) return;
+    pmtk_slot_t* slot = &pmtk_queue[pmtk_head];
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+
+    if (slot->state == PMTK_QUEUED) {
+        if (gps_tx_pos < gps_tx_len) return;  // Previous frame still going out
+        const pmtk_command_t* cmd = slot->cmd;
+        gps_tx_len = snprintf(gps_tx_frame, sizeof(gps_tx_frame), "$%s*%02X\r\n", cmd->body, cmd->checksum);
+        gps_tx_pos = 0;
+        uint32_t irq_state = save_and_disable_interrupts();
+        gps_tx_fill();  // Prime the FIFO; the TX interrupt sends the rest
+        restore_interrupts(irq_state);
+        slot->state = PMTK_SENT;
+        slot->tries++;
+        slot->sent_ms = now;
+    }
+    else if (slot->state == PMTK_SENT && gps_tx_pos >= gps_tx_len) {
+        if (!slot->cmd->acked) {
+            gps_cmd_finish(PMTK_UNACKED);
+        } else if (now - slot->sent_ms > PMTK_ACK_TIMEOUT_MS) {
+            if (slot->tries < PMTK_MAX_TRIES) {
+                slot->state = PMTK_QUEUED;  // Resend
+            } else {
+                gps_cmd_finish(PMTK_TIMED_OUT);
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// GPS link and fix rate
+// At 9600 baud the RMC/VTG/GGA/GLL set only fits about 4 fixes per second,
+// so the faster fix rate is only requested once the link is at 57600 or more
+#define GPS_TARGET_BAUD 115200
+#define GPS_PROBE_MS 1500  // Longer than one 1 Hz sentence burst
+#define GPS_DRAIN_MS 40    // A full TX FIFO (32 bytes) at 9600 baud, and a little
+
+// Rates the MTK3339 supports, most likely first
+static const uint gps_baud_rates[] = {9600, 115200, 57600, 38400, 19200, 4800};
+uint gps_baud = 0;  // Rate the module talks at, 0 until detected
+
+// Switch uart1 to baud and forget anything half received at the old rate
+void gps_set_baud(uint baud) {
+    uart_tx_wait_blocking(uart1);  // Let queued bytes leave at the old rate
+    uart_set_baudrate(uart1, baud);
+    gps_rx_tail = gps_rx_head();
+    nmea_init(&gps_nmea, gps_on_field, gps_on_sentence);
+}
+
+// Link bring-up, run a step at a time by gps_link_poll from the GPS task so
+// nothing waits on the module: find the rate it talks at, send the restart
+// and sentence set, then move it to GPS_TARGET_BAUD and check it is heard
+// there. A sentence with a good checksum means the rate is right; at the
+// wrong rate the bytes are garbage and never pass the checksum.
+typedef enum {
+    GPS_LINK_PROBE,    // Listening at gps_baud_rates[gps_link.rate]
+    GPS_LINK_CONFIG,   // Waiting for the queued commands, PMTK251 last, to go out
+    GPS_LINK_SWITCH,   // Letting PMTK251 leave the TX FIFO at the old rate
+    GPS_LINK_VERIFY,   // Listening at GPS_TARGET_BAUD
+    GPS_LINK_RECOVER,  // Not heard there; listening at the old rate again
+    GPS_LINK_READY
+} gps_link_state_t;
+
+static struct {
+    gps_link_state_t state;
+    uint8_t rate;         // Index into gps_baud_rates while probing
+    bool redetect;        // Probing after a failed switch: no second attempt
+    uint32_t since_ms;    // Entered the current state
+    uint32_t sentences;   // gps_nmea.sentences on entry
+} gps_link;
+
+static void gps_link_enter(gps_link_state_t state) {
+    gps_link.state = state;
+    gps_link.since_ms = to_ms_since_boot(get_absolute_time());
+    gps_link.sentences = gps_nmea.sentences;
+}
+
+// PMTK251 for baud, or NULL if gps.h has none
+static const pmtk_command_t* gps_baud_command(uint baud) {
+    return baud == 115200 ? &SET_BAUD_115200 : baud == 57600 ? &SET_BAUD_57600 : NULL;
+}
+
+// The rate is settled: ask for the fix rate it can carry
+static void gps_link_ready() {
+    if (gps_baud >= 57600) {
+        gps_queue_command(&SET_FIX_10HZ);  // Acknowledged later, from the GPS task
+    }
+    printf("GPS: %u baud\n", gps_baud);
+    gps_link_enter(GPS_LINK_READY);
+}
+
+// The module talks at gps_baud: configure it, then raise the rate if needed
+static void gps_link_found() {
+    if (gps_link.redetect) {
+        gps_link_ready();
+        return;
+    }
+    gps_queue_command(&COLD_RESTART);
+    gps_queue_command(&SET_NMEA_OUTPUT);
+    /* PMTK314 FIELDS: 0 = OFF, N = EVERY NTH FIX (SET_NMEA_OUTPUT is 1,1,1,1,1,5)
     0 NMEA_SEN_GLL, // GPGLL interval - Geographic Position - Latitude longitude
     1 NMEA_SEN_RMC, // GPRMC interval - Recommended Minimum Specific GNSS Sentence
     2 NMEA_SEN_VTG, // GPVTG interval - Course over Ground and Ground Speed
@@ -327,60 +1384,184 @@ void init_uart_gps() {
     5 NMEA_SEN_GSV, // GPGSV interval - GNSS Satellites in View 
     EVERYTHING AFTER THIS IS IS RESERVED UNTIL THE LAST BIT
     */
+    const pmtk_command_t* cmd = gps_baud_command(GPS_TARGET_BAUD);
+    if (gps_baud == GPS_TARGET_BAUD || !cmd || !gps_queue_command(cmd)) {
+        gps_link_ready();
+        return;
+    }
+    gps_link_enter(GPS_LINK_CONFIG);
 }
 
-void gps_periodic_irq() {
-    // UGHUGHUGH I cant do uart_read_blocking because
-    // The data length is constantly changing.
-    // This means I have to do by char...
+static void gps_link_probe(uint8_t rate) {
+    gps_link.rate = rate;
+    gps_set_baud(gps_baud_rates[rate]);
+    gps_link_enter(GPS_LINK_PROBE);
+}
 
-    char buf[BUFSIZE] = {0};
-    while (uart_is_readable(uart1)) {
-        uart_getc(uart1);
+// Advance the bring-up; called from the GPS task after gps_poll
+void gps_link_poll() {
+    uint32_t elapsed = to_ms_since_boot(get_absolute_time()) - gps_link.since_ms;
+    bool heard = gps_nmea.sentences != gps_link.sentences;
+    switch (gps_link.state) {
+        case GPS_LINK_PROBE:
+            if (heard) {
+                gps_baud = gps_baud_rates[gps_link.rate];
+                gps_link_found();
+            } else if (elapsed >= GPS_PROBE_MS) {
+                if (gps_link.rate + 1u < sizeof(gps_baud_rates) / sizeof(gps_baud_rates[0])) {
+                    gps_link_probe(gps_link.rate + 1);
+                } else {
+                    printf("GPS: no NMEA at any baud rate, staying at 9600\n");
+                    gps_baud = 9600;
+                    gps_set_baud(gps_baud);
+                    gps_link_found();
+                }
+            }
+            break;
+        case GPS_LINK_CONFIG:
+            // Everything queued so far has to go out at the old rate
+            if (gps_cmd_idle()) gps_link_enter(GPS_LINK_SWITCH);
+            break;
+        case GPS_LINK_SWITCH:
+            if (elapsed >= GPS_DRAIN_MS) {
+                gps_set_baud(GPS_TARGET_BAUD);
+                gps_link_enter(GPS_LINK_VERIFY);
+            }
+            break;
+        case GPS_LINK_VERIFY:
+            if (heard) {
+                gps_baud = GPS_TARGET_BAUD;
+                gps_link_ready();
+            } else if (elapsed >= GPS_PROBE_MS) {
+                printf("GPS: no NMEA at %u baud, recovering\n", GPS_TARGET_BAUD);
+                gps_set_baud(gps_baud);
+                gps_link_enter(GPS_LINK_RECOVER);
+            }
+            break;
+        case GPS_LINK_RECOVER:
+            if (heard) {
+                gps_link_ready();
+            } else if (elapsed >= GPS_PROBE_MS) {
+                gps_link.redetect = true;
+                gps_link_probe(0);
+            }
+            break;
+        case GPS_LINK_READY:
+            break;
     }
-    char curr;
-    do {
-        while (!uart_is_readable(uart1));  
-        curr = uart_getc(uart1);
-    } while (curr != '$');
-
-    size_t i = 0;
-    buf[i++] = '$';
+}
 
-    while (i < BUFSIZE - 1) {
+void init_uart_gps() {
+    uart_init(uart1, 9600);
+    gpio_set_function(UART_TX_PIN, UART_FUNCSEL_NUM(uart1, 0)); // TODO: double check naming of TX and RX PINS
+    gpio_set_function(UART_RX_PIN, UART_FUNCSEL_NUM(uart1, 1)); // TODO: double check naming of TX and RX PINS
+    uart_set_format(uart1, 8, 1, UART_PARITY_NONE);
+    nmea_init(&gps_nmea, gps_on_field, gps_on_sentence);
 
-        while (!uart_is_readable(uart1));  
-        curr = uart_getc(uart1);
+    // Received bytes go straight to the ring buffer; the interrupt only sends
+    gps_rx_init();
+    irq_set_exclusive_handler(UART1_IRQ, gps_uart_isr);
+    irq_set_enabled(UART1_IRQ, true);
 
-        if (curr == '\n' || curr == '\r')
-            break;
+    // The module keeps PMTK251 across resets, so look for it at every rate
+    gps_link_probe(0);
+}
 
-        buf[i++] = curr;
+// Parse everything waiting in the receive ring buffer, one byte at a time
+// Called from the GPS task; returns once the buffer is empty
+void gps_poll() {
+    uint32_t head = gps_rx_head();
+    if (head - gps_rx_tail > GPS_RX_BUFSIZE) {
+        uint32_t lost = head - gps_rx_tail - GPS_RX_BUFSIZE;
+        gps_rx_dropped += lost;
+        gps_rx_tail = head - GPS_RX_BUFSIZE;
+        printf("GPS: %lu bytes dropped\n", (unsigned long)lost);
+#ifdef PICO_SIM
+        sim_gps_dropped(lost);
+#endif
     }
-
-    buf[i] = '\0';
-
-    //printf("%s\n", buf);
-    gps_parser(buf);
-    printf("Time: %s, Message Type:%s, Speed:%s, Longitude:%s, Fixed:%s Num Sats:%s\n", gps.time, gps.ptmk, gps.ground_speed, gps.longitude, gps.fix, gps.num_sats);
+    while (gps_rx_tail != head) {
+        char curr = gps_rx_buf[gps_rx_tail & (GPS_RX_BUFSIZE - 1)];
+        gps_rx_tail++;
+        nmea_feed(&gps_nmea, curr);
+    }
+    if ((dma_channel_hw_addr(gps_rx_dma)->transfer_count & GPS_RX_DMA_COUNT) < GPS_RX_DMA_COUNT / 2) {
+        dma_channel_abort(gps_rx_dma);  // Bytes wait in the FIFO meanwhile
+        gps_rx_dma_start(gps_rx_head());
+    }
+    gps_cmd_poll();
 }
 
+// Page currently painted on the screen (PAGE_COUNT until the first draw)
+static page_t drawn_page = PAGE_COUNT;
+
+// Draw the current page
+// On page entry the page's pre-rendered background is drawn in one pass;
+// after that only widgets whose gps field changed are repainted. A page
+// button press sets draw_cancel, which cuts the draw short (see lcd.h).
 void disp_page(){
-    tft_fill_screen(RGB565(255,255,255));
+    gps_data fix;
+    gps_snapshot(&fix);
+#ifdef PICO_SIM
+    uint32_t raw_speed = fix.speed;
+#endif
+    gps_apply_motion(&fix, to_ms_since_boot(get_absolute_time()));
+    spi_stats_reset();
+    if (USE_FRAMEBUFFER) tft_target = TFT_TARGET_FRAMEBUFFER;
+    if (current_page != drawn_page) {
+        static const bg_image_t* const backgrounds[PAGE_COUNT] = {
+            [PAGE_SPEED] = &bg_speed, [PAGE_LOCATION] = &bg_location, [PAGE_TIME] = &bg_time,
+            [PAGE_SKY] = &bg_sky, [PAGE_TRIP] = &bg_trip, [PAGE_ALL] = &bg_all
+        };
+        PROFILE_BEGIN(background_start);
+        drawn_page = current_page;
+        tft_scroll_start(GRAPH_TOP);  // Unscrolled; the speed graph sets its own start
+        tft_draw_background(backgrounds[current_page]);
+        widgets_invalidate();
+        PROFILE_END(profiles, PROF_BACKGROUND, background_start);
+    }
+    PROFILE_BEGIN(draw_start);
     switch (current_page) {
         case PAGE_SPEED:   
-            display_speed(10, 10, gps.ground_speed, 0);
+            display_speed(10, 10, &fix, 0);
+            display_speed_graph(&speed_history);
             break;
         case PAGE_LOCATION:
-            display_location(10, 10, gps.latitude, gps.north_south, gps.longitude, gps.east_west, 0);
+            display_location(10, 10, &fix, 0);
             break;
         case PAGE_TIME: 
-            display_time(10, 10, gps.time, 0);   
+            display_time(10, 10, &fix, 0);   
+            break;
+        case PAGE_SKY:
+            display_sky(10, 10, &fix);
+            break;
+        case PAGE_TRIP:
+            display_trip(10, 10, &fix);
             break;
         default:   
-            display_all(gps.ground_speed, gps.latitude, gps.north_south, gps.longitude, gps.east_west, gps.time);    
+            display_all(&fix);    
             break;
     }
+    PROFILE_END(profiles, PROF_DRAW_SPEED + current_page, draw_start);
+    if (USE_FRAMEBUFFER) {
+        PROFILE_BEGIN(flush_start);
+        tft_target = TFT_TARGET_DISPLAY;
+        tft_fb_flush();
+        PROFILE_END(profiles, PROF_FB_FLUSH, flush_start);
+    }
+    spi_burst_wait();
+    if (draw_cancel) return;  // Cut short by a page button press; not a whole frame
+    spi_stats_report(get_page_label());
+#ifdef PICO_SIM
+    if (fix.valid & GPS_HAS_SPEED) sim_motion_report(raw_speed, fix.speed);
+    if (USE_FRAMEBUFFER) {
+        FILE* ppm = sim_framebuffer_report(get_page_label(), framebuffer);
+        if (ppm) {
+            tft_fb_dump_ppm(ppm);
+            fclose(ppm);
+        }
+    }
+#endif
 }
 
 //PWM FUNCTIONS
@@ -416,34 +1597,33 @@ void init_pwm_static(uint32_t period, uint32_t duty_cycle) {
     pwm_set_enabled(slice_num_1, true);
 }
 
+// LED task: brightness follows the filtered speed
 void pwm_breathing() {
+    PROFILE_BEGIN(start);
     uint slice_num_0 = pwm_gpio_to_slice_num(led_1);
     uint slice_num_1 = pwm_gpio_to_slice_num(led_3);
-    pwm_hw->intr = 1u << slice_num_0;
-
-    float speed_setting = 0.0f;
-    if (gps.ground_speed && gps.ground_speed[0] != '\0')
-        speed_setting = strtof(gps.ground_speed, NULL);
 
-    duty_cycle = speed_setting * 200;
+    // 200 counts per km/h; speed is km/h x 100
+    gps_data fix;
+    gps_snapshot(&fix);
+    uint32_t speed = fix.speed;
+    if (fix.valid & GPS_HAS_MOTION) speed = kalman_speed_at(&fix.motion, to_ms_since_boot(get_absolute_time()));
+    duty_cycle = (fix.valid & GPS_HAS_SPEED) ? speed * 2 : 0;
 
     pwm_set_chan_level(slice_num_0, pwm_gpio_to_channel(led_1), duty_cycle);
     pwm_set_chan_level(slice_num_0, pwm_gpio_to_channel(led_2), duty_cycle);
     pwm_set_chan_level(slice_num_1, pwm_gpio_to_channel(led_3), duty_cycle);
     pwm_set_chan_level(slice_num_1, pwm_gpio_to_channel(led_4), duty_cycle);
+    PROFILE_END(profiles, PROF_LEDS, start);
 }
 
 
-void init_pwm_irq() {
-    // Use the slice that drives PWM_PIN0 for the IRQ
+// The LEDs used to be updated from the PWM wrap interrupt, every period
+// (~21 ms); the LED task now does it on a timer, so only the startup levels remain
+void init_pwm_levels() {
     uint slice_num_0 = pwm_gpio_to_slice_num(led_1);
     uint slice_num_1 = pwm_gpio_to_slice_num(led_3);
 
-    irq_set_exclusive_handler(PWM_DEFAULT_IRQ_NUM(), pwm_breathing);
-    irq_set_enabled(PWM_DEFAULT_IRQ_NUM(), true);
-    pwm_set_irq0_enabled(slice_num_0, true);
-    pwm_set_irq1_enabled(slice_num_1, true);
-
     uint current_period = pwm_hw->slice[slice_num_0].top;
 
 
@@ -455,28 +1635,81 @@ void init_pwm_irq() {
 
 //////////////////////////////////////////////////////////////////////////////
 
+// GPS task: parse what the uart1 DMA channel received, bring the link up and drive the PMTK queue
+// The DMA raises no interrupt, so the task polls; a fix burst waits at most
+// GPS_POLL_US to be parsed
+void gps_task() {
+    gps_poll();
+    gps_link_poll();
+}
+
+// USB task: keeps itself ready while an export has more to send
+void usb_task() {
+    track_export_poll();
+    if (track_export.active) sched_post(&io_sched, IO_TASK_USB);
+}
+
+// Budgets are the deadlines checked by the TASKS command: a redraw must end
+// before the next one is due, and parsing before the RX buffer fills
+static sched_task_t ui_tasks[UI_TASK_COUNT] = {
+    [UI_TASK_PAGE] = { "page", page_task, 0, SCREEN_PERIOD_US },
+    [UI_TASK_RENDER] = { "render", render_task, SCREEN_PERIOD_US, SCREEN_PERIOD_US },
+};
+static sched_task_t io_tasks[IO_TASK_COUNT] = {
+    [IO_TASK_GPS] = { "gps", gps_task, GPS_POLL_US, 20000 },
+    [IO_TASK_LEDS] = { "leds", pwm_breathing, 40000, 1000 },
+    [IO_TASK_USB] = { "usb", usb_task, 10000, 2000 },
+    [IO_TASK_POWER] = { "power", power_task, 1000000, 1000 },
+};
+#define IO_WORK_BUDGET_US 60000  // Track log append, which may erase a sector
+
+// Core 1: all display work
+// The SPI/DMA and page button interrupts are enabled from here, so their
+// handlers and the display tasks run on this core and never delay GPS input
+void core1_main() {
+    profile_init();
+    flash_safe_execute_core_init();  // Let core 0 pause this core while it writes the track log
+    init_spi();
+    init_disp();
+    tft_init();
+    tft_fill_screen(RGB565(255, 255, 255));
+    sched_init(&ui_sched, ui_tasks, UI_TASK_COUNT, 1, 0);
+    sched_timer(&ui_sched, UI_TASK_RENDER, SCREEN_STARTUP_US);
+    page_sel_init();
+
+    for(;;) {
+        if (!sched_run_once(&ui_sched)) sched_idle(&ui_sched);
+    }
+}
 
 int main()
 {
     /*Call all inits here*/
     stdio_init_all();
-    init_uart_gps();
-    page_sel_init();
-    init_startup_timer();
-    init_spi();
-    init_disp();
-    tft_init();
-   
+    profile_init();
+
+    // Display comes up on its own core while the GPS link is negotiated
+    multicore_launch_core1(core1_main);
 
     uint32_t period = 100000;     // tune as desired
-    uint32_t initial_dc = 0;    // start from 0% and let ISR drive it
+    uint32_t initial_dc = 0;    // start from 0% and let the LED task drive it
 
     init_pwm_static(period, initial_dc);
-    init_pwm_irq();
+    init_pwm_levels();
     // -------------------------------
 
-    tft_fill_screen(RGB565(255, 255, 255));
+    // Before the uart1 interrupt can post to it; the tasks first run once
+    // init_uart_gps has found the module
+    sched_init(&io_sched, io_tasks, IO_TASK_COUNT, 2, IO_WORK_BUDGET_US);
+    init_track();
+    init_trip();
+    power_init(&power, POWER_PARK_S);
+    init_uart_gps();
 
-    for(;;);
+    // Core 0: GPS parsing, LEDs, track logging, export and power; each core
+    // sleeps in WFI until an interrupt when it has nothing to run
+    for(;;) {
+        if (!sched_run_once(&io_sched)) sched_idle(&io_sched);
+    }
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include <string.h>
+#include "nmea.h"
+
+// Value of a hex digit, or -1 if c is not one
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+// Decode the sentence type from the address field
+// The first two characters are the talker, so only the formatter is compared
+static nmea_sentence_t sentence_type(const char* field, uint8_t len) {
+    if (len >= 4 && strncmp(field, "PMTK", 4) == 0) return NMEA_PMTK;
+    if (len != 5) return NMEA_UNKNOWN;
+    const char* f = field + 2;
+    if (strncmp(f, "RMC", 3) == 0) return NMEA_RMC;
+    if (strncmp(f, "VTG", 3) == 0) return NMEA_VTG;
+    if (strncmp(f, "GGA", 3) == 0) return NMEA_GGA;
+    if (strncmp(f, "GSA", 3) == 0) return NMEA_GSA;
+    if (strncmp(f, "GSV", 3) == 0) return NMEA_GSV;
+    return NMEA_UNKNOWN;
+}
+
+// Report the field collected so far and start the next one
+static void end_field(nmea_parser_t* p) {
+    p->field[p->field_len] = '\0';
+    if (p->field_index == 0) {
+        p->type = sentence_type(p->field, p->field_len);
+    }
+    if (p->on_field) {
+        p->on_field(p->type, p->field_index, p->field, p->field_len);
+    }
+    p->field_index++;
+    p->field_len = 0;
+}
+
+// Report the end of the sentence and wait for the next '$'
+static void end_sentence(nmea_parser_t* p, bool valid) {
+    if (valid) {
+        p->sentences++;
+    } else {
+        p->checksum_errors++;
+    }
+    if (p->on_sentence) {
+        p->on_sentence(p->type, valid);
+    }
+    p->state = NMEA_WAIT_START;
+}
+
+void nmea_init(nmea_parser_t* p, nmea_field_cb_t on_field, nmea_sentence_cb_t on_sentence) {
+    memset(p, 0, sizeof(*p));
+    p->state = NMEA_WAIT_START;
+    p->on_field = on_field;
+    p->on_sentence = on_sentence;
+}
+
+void nmea_feed(nmea_parser_t* p, char c) {
+    if (c == '$') {
+        // A '$' always starts a new sentence; an unfinished one is dropped
+        if (p->state != NMEA_WAIT_START) {
+            end_sentence(p, false);
+        }
+        p->state = NMEA_BODY;
+        p->type = NMEA_UNKNOWN;
+        p->checksum = 0;
+        p->field_index = 0;
+        p->field_len = 0;
+        p->overflow = false;
+        return;
+    }
+
+    switch (p->state) {
+        case NMEA_WAIT_START:
+            break;
+
+        case NMEA_BODY:
+            if (c == '\r' || c == '\n') {
+                // Sentence ended without a checksum
+                end_field(p);
+                end_sentence(p, false);
+            } else if (c == '*') {
+                end_field(p);
+                p->state = NMEA_CHECKSUM_HI;
+            } else {
+                p->checksum ^= (uint8_t)c;
+                if (c == ',') {
+                    end_field(p);
+                } else if (p->field_len < NMEA_FIELD_MAX) {
+                    p->field[p->field_len++] = c;
+                } else {
+                    p->overflow = true;
+                }
+            }
+            break;
+
+        case NMEA_CHECKSUM_HI: {
+            int v = hex_value(c);
+            if (v < 0) {
+                end_sentence(p, false);
+            } else {
+                p->expected = (uint8_t)(v << 4);
+                p->state = NMEA_CHECKSUM_LO;
+            }
+            break;
+        }
+
+        case NMEA_CHECKSUM_LO: {
+            int v = hex_value(c);
+            if (v < 0) {
+                end_sentence(p, false);
+            } else {
+                p->expected |= (uint8_t)v;
+                end_sentence(p, p->expected == p->checksum && !p->overflow);
+            }
+            break;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Parse an unsigned decimal into an integer scaled by 10^decimals
+static bool parse_scaled(const char* text, uint8_t decimals, int64_t* out) {
+    int64_t value = 0;
+    bool digits = false;
+    bool negative = false;
+
+    if (*text == '-') {
+        negative = true;
+        text++;
+    }
+    while (*text >= '0' && *text <= '9') {
+        value = value * 10 + (*text++ - '0');
+        digits = true;
+    }
+    uint8_t frac = 0;
+    if (*text == '.') {
+        text++;
+        while (*text >= '0' && *text <= '9') {
+            if (frac < decimals) {
+                value = value * 10 + (*text - '0');
+                frac++;
+            }
+            text++;
+            digits = true;
+        }
+    }
+    if (!digits || *text != '\0') return false;
+    for (; frac < decimals; frac++) {
+        value *= 10;
+    }
+    *out = negative ? -value : value;
+    return true;
+}
+
+// Two digits at text as a number, or -1
+static int two_digits(const char* text) {
+    if (text[0] < '0' || text[0] > '9' || text[1] < '0' || text[1] > '9') return -1;
+    return (text[0] - '0') * 10 + (text[1] - '0');
+}
+
+bool nmea_parse_fixed(const char* text, uint8_t decimals, int32_t* out) {
+    int64_t value;
+    if (!parse_scaled(text, decimals, &value)) return false;
+    *out = (int32_t)value;
+    return true;
+}
+
+bool nmea_parse_coord(const char* text, int32_t* out) {
+    // dddmm.mmmmmm with six decimals: whole degrees sit above 10^8
+    int64_t value;
+    if (!parse_scaled(text, 6, &value) || value < 0) return false;
+    int64_t degrees = value / 100000000;
+    int64_t micro_minutes = value % 100000000;
+    *out = (int32_t)(degrees * 1000000 + micro_minutes / 60);
+    return true;
+}
+
+bool nmea_parse_time(const char* text, uint32_t* out) {
+    int h = two_digits(text);
+    int m = h < 0 ? -1 : two_digits(text + 2);
+    int s = m < 0 ? -1 : two_digits(text + 4);
+    if (s < 0 || h > 23 || m > 59 || s > 60) return false;
+    *out = (uint32_t)(h * 3600 + m * 60 + s);
+    return true;
+}
+
+bool nmea_parse_date(const char* text, uint8_t* day, uint8_t* month, uint16_t* year) {
+    int d = two_digits(text);
+    int m = d < 0 ? -1 : two_digits(text + 2);
+    int y = m < 0 ? -1 : two_digits(text + 4);
+    if (y < 0 || text[6] != '\0' || d < 1 || d > 31 || m < 1 || m > 12) return false;
+    *day = (uint8_t)d;
+    *month = (uint8_t)m;
+    *year = (uint16_t)(2000 + y);
+    return true;
+}
@@ -0,0 +1,56 @@
+#include "power.h"
+
+static void power_enter(power_t* p, power_state_t state) {
+    p->state = state;
+    p->state_s = 0;
+    p->check_fixes = 0;
+}
+
+void power_init(power_t* p, uint32_t park_s) {
+    p->park_s = park_s;
+    p->parked_s = 0;
+    power_enter(p, POWER_AWAKE);
+}
+
+void power_wake(power_t* p) {
+    p->parked_s = 0;
+    if (p->state != POWER_AWAKE) power_enter(p, POWER_AWAKE);
+}
+
+power_state_t power_tick(power_t* p, bool moving, bool fix) {
+    p->state_s++;
+    switch (p->state) {
+        case POWER_AWAKE:
+        case POWER_IDLE:
+            if (moving) {
+                power_wake(p);
+                break;
+            }
+            p->parked_s++;
+            if (p->park_s && p->parked_s >= p->park_s) {
+                power_enter(p, POWER_STANDBY);
+            } else if (p->parked_s >= POWER_IDLE_S && p->state == POWER_AWAKE) {
+                power_enter(p, POWER_IDLE);
+            }
+            break;
+        case POWER_STANDBY:
+            if (p->state_s >= POWER_CHECK_S) power_enter(p, POWER_CHECK);
+            break;
+        case POWER_CHECK:
+            // Only fixes that arrived since the GPS woke up say anything
+            if (moving && fix) {
+                power_wake(p);
+            } else if ((fix && ++p->check_fixes >= POWER_CHECK_FIXES) || p->state_s >= POWER_CHECK_MAX_S) {
+                power_enter(p, POWER_STANDBY);
+            }
+            break;
+    }
+    return p->state;
+}
+
+const char* power_state_name(power_state_t state) {
+    static const char* const names[] = {
+        [POWER_AWAKE] = "awake", [POWER_IDLE] = "idle", [POWER_STANDBY] = "standby", [POWER_CHECK] = "check"
+    };
+    return names[state];
+}
@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include "profile.h"
+
+#if PROFILE_ENABLED
+
+#include "hardware/clocks.h"
+
+void profile_init(void) {
+    m33_hw->demcr |= M33_DEMCR_TRCENA_BITS;  // DWT is off until trace is enabled
+    m33_hw->dwt_cyccnt = 0;
+    m33_hw->dwt_ctrl |= M33_DWT_CTRL_CYCCNTENA_BITS;
+}
+
+void profile_record(profile_t* p, uint32_t cycles) {
+    if (p->count == 0 || cycles < p->min) p->min = cycles;
+    if (cycles > p->max) p->max = cycles;
+    p->total += cycles;
+    p->count++;
+    p->hist[31 - __builtin_clz(cycles | 1)]++;
+}
+
+void profile_reset(profile_t* table, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        profile_t* p = &table[i];
+        p->count = p->min = p->max = 0;
+        p->total = 0;
+        for (int b = 0; b < PROFILE_BUCKETS; b++) p->hist[b] = 0;
+    }
+}
+
+// One line of counts and times per entry, then its non-empty buckets
+void profile_dump(const profile_t* table, size_t count) {
+    uint32_t mhz = clock_get_hz(clk_sys) / 1000000;
+    printf("PROFILE: cycles at %lu MHz (min/mean/max, us in brackets)\n", (unsigned long)mhz);
+    for (size_t i = 0; i < count; i++) {
+        const profile_t* p = &table[i];
+        if (p->count == 0) {
+            printf("%-18s never ran\n", p->name);
+            continue;
+        }
+        uint32_t mean = (uint32_t)(p->total / p->count);
+        printf("%-18s %8lu runs %10lu %10lu %10lu  [%lu %lu %lu]\n", p->name,
+               (unsigned long)p->count, (unsigned long)p->min, (unsigned long)mean,
+               (unsigned long)p->max, (unsigned long)(p->min / mhz),
+               (unsigned long)(mean / mhz), (unsigned long)(p->max / mhz));
+        printf("  ");
+        for (int b = 0; b < PROFILE_BUCKETS; b++) {
+            if (p->hist[b]) printf(" <2^%d:%lu", b + 1, (unsigned long)p->hist[b]);
+        }
+        printf("\n");
+    }
+}
+
+#endif
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include "sched.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "pico/time.h"
+
+// Scheduler of each core, for the shared alarm handler
+static sched_t* sched_core[2];
+
+static void sched_alarm_isr(void) {
+    sched_t* s = sched_core[get_core_num()];
+    timer0_hw->intr = 1u << s->alarm;
+    s->timer_event = true;
+}
+
+// Point the alarm at the earliest running timer
+// An alarm written for a time that already passed would only fire after the
+// counter wraps, so that case is flagged straight away
+static void sched_arm(sched_t* s) {
+    bool any = false;
+    uint32_t due = 0;
+    for (uint8_t i = 0; i < s->count; i++) {
+        sched_task_t* t = &s->tasks[i];
+        if (!t->timer_on) continue;
+        if (!any || (int32_t)(t->due_us - due) < 0) due = t->due_us;
+        any = true;
+    }
+    if (!any) return;
+    timer0_hw->alarm[s->alarm] = due;
+    if ((int32_t)(due - time_us_32()) <= 0) s->timer_event = true;
+}
+
+static void sched_ready(sched_t* s, uint8_t id, uint32_t since) {
+    uint32_t irq = save_and_disable_interrupts();
+    if (!(s->ready & (1u << id))) {
+        s->tasks[id].ready_us = since;
+        s->ready |= 1u << id;
+    }
+    restore_interrupts(irq);
+}
+
+// Make expired timers' tasks ready; a period that was missed entirely is skipped
+static void sched_expire(sched_t* s) {
+    uint32_t now = time_us_32();
+    for (uint8_t i = 0; i < s->count; i++) {
+        sched_task_t* t = &s->tasks[i];
+        if (!t->timer_on || (int32_t)(now - t->due_us) < 0) continue;
+        sched_ready(s, i, t->due_us);
+        if (t->period_us) {
+            t->due_us += t->period_us;
+            if ((int32_t)(now - t->due_us) >= 0) t->due_us = now + t->period_us;
+        } else {
+            t->timer_on = false;
+        }
+    }
+    sched_arm(s);
+}
+
+static void sched_record(sched_stats_t* st, uint32_t latency, uint32_t run, uint32_t budget) {
+    st->runs++;
+    st->total_us += run;
+    if (run > st->max_run_us) st->max_run_us = run;
+    if (latency > st->max_latency_us) st->max_latency_us = latency;
+    if (budget && run > budget) st->overruns++;
+}
+
+void sched_init(sched_t* s, sched_task_t* tasks, uint8_t count, uint8_t alarm, uint32_t work_budget_us) {
+    s->tasks = tasks;
+    s->count = count;
+    s->alarm = alarm;
+    s->work_budget_us = work_budget_us;
+    uint32_t now = time_us_32();
+    for (uint8_t i = 0; i < count; i++) {
+        tasks[i].timer_on = tasks[i].period_us != 0;
+        tasks[i].due_us = now + tasks[i].period_us;
+    }
+    sched_core[get_core_num()] = s;
+    irq_set_exclusive_handler(TIMER0_IRQ_0 + alarm, sched_alarm_isr);
+    timer0_hw->inte |= 1u << alarm;
+    irq_set_enabled(TIMER0_IRQ_0 + alarm, true);
+    sched_arm(s);
+}
+
+void sched_post(sched_t* s, uint8_t id) {
+    sched_ready(s, id, time_us_32());
+}
+
+bool sched_defer(sched_t* s, sched_fn_t fn, void* arg) {
+    bool ok = false;
+    uint32_t irq = save_and_disable_interrupts();
+    uint32_t head = s->work_head;
+    if (head - s->work_tail < SCHED_WORK_SIZE) {
+        sched_work_t* w = &s->work[head & (SCHED_WORK_SIZE - 1)];
+        w->fn = fn;
+        w->arg = arg;
+        w->queued_us = time_us_32();
+        s->work_head = head + 1;
+        ok = true;
+    } else {
+        s->work_dropped++;
+    }
+    restore_interrupts(irq);
+    return ok;
+}
+
+void sched_timer(sched_t* s, uint8_t id, uint32_t delay_us) {
+    sched_task_t* t = &s->tasks[id];
+    t->due_us = time_us_32() + delay_us;
+    t->timer_on = true;
+    sched_arm(s);
+}
+
+bool sched_run_once(sched_t* s) {
+    if (s->timer_event) {
+        s->timer_event = false;  // Cleared first: an alarm during the scan flags it again
+        sched_expire(s);
+    }
+
+    uint32_t irq = save_and_disable_interrupts();
+    uint32_t ready = s->ready;
+    s->ready = ready & (ready - 1);  // Take the lowest bit, the highest priority
+    restore_interrupts(irq);
+
+    if (ready) {
+        sched_task_t* t = &s->tasks[__builtin_ctz(ready)];
+        uint32_t start = time_us_32();
+        uint32_t latency = start - t->ready_us;  // Before a post during the run moves ready_us
+        t->run();
+        sched_record(&t->stats, latency, time_us_32() - start, t->budget_us);
+        return true;
+    }
+    if (s->work_tail == s->work_head) return s->timer_event;  // An alarm may have come in meanwhile
+
+    sched_work_t w = s->work[s->work_tail & (SCHED_WORK_SIZE - 1)];
+    s->work_tail++;
+    uint32_t start = time_us_32();
+    w.fn(w.arg);
+    sched_record(&s->work_stats, start - w.queued_us, time_us_32() - start, s->work_budget_us);
+    return true;
+}
+
+// Interrupts are masked across the check and the WFI, so a post cannot land
+// between them; a pending interrupt still ends the WFI and runs on restore
+void sched_idle(sched_t* s) {
+    uint32_t irq = save_and_disable_interrupts();
+    if (!s->ready && !s->timer_event && s->work_tail == s->work_head) __wfi();
+    restore_interrupts(irq);
+}
+
+static void sched_dump_stats(const char* name, const sched_stats_t* st, uint32_t budget) {
+    if (st->runs == 0) {
+        printf("  %-14s never ran\n", name);
+        return;
+    }
+    printf("  %-14s %8lu runs, run mean/max %lu/%lu us (budget %lu), %lu over, latency max %lu us\n", name,
+           (unsigned long)st->runs, (unsigned long)(st->total_us / st->runs), (unsigned long)st->max_run_us,
+           (unsigned long)budget, (unsigned long)st->overruns, (unsigned long)st->max_latency_us);
+}
+
+void sched_dump(const sched_t* s, const char* name) {
+    printf("TASKS %s:\n", name);
+    for (uint8_t i = 0; i < s->count; i++) {
+        sched_dump_stats(s->tasks[i].name, &s->tasks[i].stats, s->tasks[i].budget_us);
+    }
+    sched_dump_stats("(deferred)", &s->work_stats, s->work_budget_us);
+    if (s->work_dropped) printf("  %lu work items dropped\n", (unsigned long)s->work_dropped);
+}
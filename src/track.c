@@ -0,0 +1,191 @@
+#include <string.h>
+#include "track.h"
+
+#define TRACK_PAGES (TRACK_SECTOR_SIZE / TRACK_PAGE_SIZE)
+
+// Byte offset of a sector sequence number in the region
+static uint32_t sector_offset(const track_log_t* log, uint32_t sequence) {
+    return (sequence % log->sectors) * TRACK_SECTOR_SIZE;
+}
+
+// Byte offset of a record slot inside its sector (slot 0 follows the header)
+static uint32_t slot_offset(uint32_t slot) {
+    return sizeof(track_sector_t) + slot * sizeof(track_record_t);
+}
+
+// True if the header at sequence's sector belongs to that sequence
+static bool sector_valid(const track_log_t* log, uint32_t sequence) {
+    track_sector_t hdr;
+    log->flash->read(sector_offset(log, sequence), &hdr, sizeof(hdr));
+    return hdr.magic == TRACK_MAGIC && hdr.sequence == sequence;
+}
+
+// True if len bytes at offset are all erased
+static bool flash_blank(const track_log_t* log, uint32_t offset, uint32_t len) {
+    uint8_t buf[64];
+    while (len) {
+        uint32_t n = len < sizeof(buf) ? len : sizeof(buf);
+        log->flash->read(offset, buf, n);
+        for (uint32_t i = 0; i < n; i++) {
+            if (buf[i] != 0xFF) return false;
+        }
+        offset += n;
+        len -= n;
+    }
+    return true;
+}
+
+static uint8_t record_check(const track_record_t* rec) {
+    const uint8_t* bytes = (const uint8_t*)rec;
+    uint8_t check = 0;
+    for (uint32_t i = 0; i < sizeof(*rec) - 1; i++) check ^= bytes[i];
+    return check;
+}
+
+track_record_t* track_seal(track_record_t* rec) {
+    rec->check = record_check(rec);
+    return rec;
+}
+
+void track_init(track_log_t* log, const track_flash_t* flash) {
+    memset(log, 0, sizeof(*log));
+    log->flash = flash;
+    log->sectors = flash->size / TRACK_SECTOR_SIZE;
+    memset(log->page_buf, 0xFF, sizeof(log->page_buf));
+
+    // The newest and oldest headers bound the log
+    bool found = false;
+    for (uint32_t s = 0; s < log->sectors; s++) {
+        track_sector_t hdr;
+        flash->read(s * TRACK_SECTOR_SIZE, &hdr, sizeof(hdr));
+        if (hdr.magic != TRACK_MAGIC || hdr.sequence % log->sectors != s) continue;
+        if (!found || hdr.sequence > log->head) log->head = hdr.sequence;
+        if (!found || hdr.sequence < log->oldest) log->oldest = hdr.sequence;
+        found = true;
+    }
+    if (!found) return;  // Empty log; the first append opens sector 0
+    if (log->head >= log->oldest + log->sectors) log->oldest = log->head - log->sectors + 1;
+
+    // Resume after the last programmed page of the newest sector
+    // A page torn by a power loss is left as is; its records fail their check
+    uint32_t base = sector_offset(log, log->head);
+    uint16_t page = TRACK_PAGES;
+    while (page > 1 && flash_blank(log, base + (page - 1) * TRACK_PAGE_SIZE, TRACK_PAGE_SIZE)) {
+        page--;
+    }
+    if (page == TRACK_PAGES) {
+        log->head++;  // Full; the next append opens a new sector
+        return;
+    }
+    log->open = true;
+    log->page = page;
+}
+
+// Start the sector for log->head: drop it from the log if it held the oldest
+// data, erase it, and put its header at the front of the page buffer
+static void open_sector(track_log_t* log) {
+    if (log->head >= log->oldest + log->sectors) log->oldest = log->head - log->sectors + 1;
+
+    uint32_t base = sector_offset(log, log->head);
+    if (!flash_blank(log, base, TRACK_SECTOR_SIZE)) {
+        log->flash->erase(base);
+        log->erases++;
+    }
+    track_sector_t hdr = { TRACK_MAGIC, log->head, { 0xFFFFFFFF, 0xFFFFFFFF } };
+    memset(log->page_buf, 0xFF, sizeof(log->page_buf));
+    memcpy(log->page_buf, &hdr, sizeof(hdr));
+    log->page = 0;
+    log->page_fill = sizeof(hdr);
+    log->open = true;
+}
+
+// Program the page buffer and move to the next page (or sector)
+static void commit_page(track_log_t* log) {
+    log->flash->program(sector_offset(log, log->head) + log->page * TRACK_PAGE_SIZE, log->page_buf);
+    log->programs++;
+    memset(log->page_buf, 0xFF, sizeof(log->page_buf));
+    log->page_fill = 0;
+    if (++log->page == TRACK_PAGES) {
+        log->open = false;
+        log->head++;
+    }
+}
+
+void track_append(track_log_t* log, const track_record_t* rec) {
+    if (!log->open) open_sector(log);
+    memcpy(log->page_buf + log->page_fill, rec, sizeof(*rec));
+    log->page_fill += sizeof(*rec);
+    log->appended++;
+    if (log->page_fill == TRACK_PAGE_SIZE) commit_page(log);
+}
+
+void track_sync(track_log_t* log) {
+    // Only the header in the buffer means no records to save
+    uint16_t empty = log->page == 0 ? sizeof(track_sector_t) : 0;
+    if (log->open && log->page_fill > empty) commit_page(log);
+}
+
+uint32_t track_first(const track_log_t* log) {
+    return log->oldest * TRACK_SECTOR_RECORDS;
+}
+
+bool track_read(const track_log_t* log, uint32_t* index, track_record_t* rec) {
+    uint32_t idx = *index < track_first(log) ? track_first(log) : *index;
+    uint32_t last = log->open ? log->head : log->head - 1;  // Newest sector holding records
+    if (!log->open && log->head == 0) return false;
+
+    for (uint32_t seq = idx / TRACK_SECTOR_RECORDS; seq <= last; seq++) {
+        uint32_t slot = seq == idx / TRACK_SECTOR_RECORDS ? idx % TRACK_SECTOR_RECORDS : 0;
+        // Records of the open sector only reach flash as their page is programmed
+        bool buffered = log->open && seq == log->head;
+        if (!buffered && !sector_valid(log, seq)) continue;
+
+        for (; slot < TRACK_SECTOR_RECORDS; slot++) {
+            uint32_t offset = slot_offset(slot);
+            uint16_t page = offset / TRACK_PAGE_SIZE;
+            if (buffered && page == log->page) {
+                if (offset % TRACK_PAGE_SIZE >= log->page_fill) return false;  // End of the log
+                memcpy(rec, log->page_buf + offset % TRACK_PAGE_SIZE, sizeof(*rec));
+            } else if (buffered && page > log->page) {
+                return false;
+            } else {
+                log->flash->read(sector_offset(log, seq) + offset, rec, sizeof(*rec));
+            }
+            if (rec->time != 0xFFFFFFFF && rec->check == record_check(rec)) {
+                *index = seq * TRACK_SECTOR_RECORDS + slot;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+uint32_t track_extent(const track_log_t* log, uint32_t* index, uint32_t* offset) {
+    uint32_t idx = *index < track_first(log) ? track_first(log) : *index;
+    if (!log->open && log->head == 0) return 0;
+    uint32_t last = log->open ? log->head : log->head - 1;
+
+    for (uint32_t seq = idx / TRACK_SECTOR_RECORDS; seq <= last; seq++) {
+        uint32_t slot = seq == idx / TRACK_SECTOR_RECORDS ? idx % TRACK_SECTOR_RECORDS : 0;
+        if (!sector_valid(log, seq)) continue;
+        // The open sector is only programmed up to its current page
+        uint32_t end = TRACK_SECTOR_RECORDS;
+        if (log->open && seq == log->head) {
+            end = (log->page * TRACK_PAGE_SIZE - sizeof(track_sector_t)) / sizeof(track_record_t);
+        }
+        if (slot >= end) continue;
+        *index = seq * TRACK_SECTOR_RECORDS + slot;
+        *offset = sector_offset(log, seq) + slot_offset(slot);
+        return end - slot;
+    }
+    return 0;
+}
+
+uint32_t track_time(uint16_t year, uint8_t month, uint8_t day, uint32_t seconds) {
+    // Days from 2000-01-01, counting years from March so leap days come last
+    int32_t y = year - (month <= 2);
+    int32_t m = month <= 2 ? month + 9 : month - 3;
+    int32_t days = 365 * y + y / 4 - y / 100 + y / 400 + (153 * m + 2) / 5 + day - 1;
+    days -= 730425;  // Same formula for 2000-01-01
+    return (uint32_t)days * 86400u + seconds;
+}
@@ -0,0 +1,61 @@
+#include "trig.h"
+
+#define STEP_BITS (14 - SINE_TABLE_BITS)  // Angle bits between table entries
+
+// Sine of the first quadrant, angle 0..ANGLE_QUARTER
+static int32_t quarter_sine(uint32_t angle) {
+    uint32_t i = angle >> STEP_BITS;
+    uint32_t frac = angle & ((1u << STEP_BITS) - 1);
+    if (frac == 0) return sine_table[i];
+    int32_t a = sine_table[i], b = sine_table[i + 1];
+    return a + (((b - a) * (int32_t)frac + (1 << (STEP_BITS - 1))) >> STEP_BITS);
+}
+
+// Fold the angle into the first quadrant and fix the sign
+int32_t sin_q15(uint16_t angle) {
+    uint32_t a = angle & (ANGLE_QUARTER - 1);
+    switch (angle >> 14) {
+        case 0: return quarter_sine(a);
+        case 1: return quarter_sine(ANGLE_QUARTER - a);
+        case 2: return -quarter_sine(a);
+        default: return -quarter_sine(ANGLE_QUARTER - a);
+    }
+}
+
+int32_t cos_q15(uint16_t angle) {
+    return sin_q15(angle + ANGLE_QUARTER);
+}
+
+int32_t mul_q15(int32_t value, int32_t q15) {
+    return (value * q15 + (1 << 14)) >> 15;
+}
+
+// Bit by bit, one result bit per iteration
+uint32_t isqrt32(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > value) bit >>= 2;
+    while (bit) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// Shift both sides down until the sum of squares fits isqrt32
+uint64_t hypot64(int64_t a, int64_t b) {
+    uint64_t x = a < 0 ? -a : a;
+    uint64_t y = b < 0 ? -b : b;
+    int shift = 0;
+    while (x > 32767 || y > 32767) {
+        x >>= 1;
+        y >>= 1;
+        shift++;
+    }
+    return (uint64_t)isqrt32(x * x + y * y) << shift;
+}
@@ -0,0 +1,141 @@
+#include <string.h>
+#include "trip.h"
+#include "trig.h"
+
+#define ODOMETER_ENTRIES (ODOMETER_SECTORS * ODOMETER_SECTOR_ENTRIES)
+
+static bool entry_valid(const odometer_entry_t* e) {
+    return e->check == ~e->meters;
+}
+
+static bool entry_blank(const odometer_entry_t* e) {
+    return e->meters == 0xFFFFFFFFu && e->check == 0xFFFFFFFFu;
+}
+
+// Largest valid total in the store; the next entry goes in the first blank
+// slot after it, or opens the next sector
+static void odometer_load(trip_t* t) {
+    odometer_entry_t e;
+    bool found = false;
+    uint32_t best_slot = 0;
+    for (uint32_t slot = 0; slot < ODOMETER_ENTRIES; slot++) {
+        t->flash->read(slot * sizeof(e), &e, sizeof(e));
+        if (entry_valid(&e) && (!found || e.meters >= t->saved_m)) {
+            t->saved_m = e.meters;
+            best_slot = slot;
+            found = true;
+        }
+    }
+    if (!found) return;  // Empty store; the first save goes in sector 0
+
+    // Skip torn entries after the newest one, up to the end of its sector
+    uint32_t slot = best_slot + 1;
+    while (slot % ODOMETER_SECTOR_ENTRIES) {
+        t->flash->read(slot * sizeof(e), &e, sizeof(e));
+        if (entry_blank(&e)) break;
+        slot++;
+    }
+    t->slot = slot % ODOMETER_ENTRIES;
+    t->odometer_mm = (uint64_t)t->saved_m * 1000;
+}
+
+// True if the sector at offset is all erased
+static bool sector_blank(const trip_t* t, uint32_t offset) {
+    uint8_t buf[64];
+    for (uint32_t done = 0; done < TRACK_SECTOR_SIZE; done += sizeof(buf)) {
+        t->flash->read(offset + done, buf, sizeof(buf));
+        for (uint32_t i = 0; i < sizeof(buf); i++) {
+            if (buf[i] != 0xFF) return false;
+        }
+    }
+    return true;
+}
+
+// Append a total; entering a sector erases it first (unless it is still
+// blank, as on a new store), while the other sector holds the previous total
+static void odometer_save(trip_t* t, uint32_t meters) {
+    t->saved_m = meters;
+    if (!t->flash) return;
+    uint32_t slot = t->slot;
+    uint32_t sector = slot / ODOMETER_SECTOR_ENTRIES * TRACK_SECTOR_SIZE;
+    if (slot % ODOMETER_SECTOR_ENTRIES == 0 && !sector_blank(t, sector)) t->flash->erase(sector);
+
+    // Program a whole page of 0xFF around the entry; erased bits stay as they are
+    uint8_t page[TRACK_PAGE_SIZE];
+    uint32_t offset = slot * sizeof(odometer_entry_t);
+    odometer_entry_t e = { meters, ~meters };
+    memset(page, 0xFF, sizeof(page));
+    memcpy(page + offset % TRACK_PAGE_SIZE, &e, sizeof(e));
+    t->flash->program(offset - offset % TRACK_PAGE_SIZE, page);
+    t->slot = (slot + 1) % ODOMETER_ENTRIES;
+}
+
+void trip_init(trip_t* t, const track_flash_t* flash) {
+    memset(t, 0, sizeof(*t));
+    t->flash = flash;
+    if (flash) odometer_load(t);
+}
+
+void trip_reset(trip_t* t) {
+    t->distance_mm = 0;
+    t->moving_s = 0;
+    t->max_speed = 0;
+}
+
+// Length of the step from the previous fix, equirectangular around the reference latitude
+static uint64_t step_mm(trip_t* t, int32_t latitude, int32_t longitude) {
+    int32_t drift = latitude - t->ref_latitude;
+    if (t->cos_latitude == 0 || drift > TRIP_REF_DRIFT || drift < -TRIP_REF_DRIFT) {
+        t->ref_latitude = latitude;
+        t->cos_latitude = cos_q15((uint16_t)((int64_t)latitude * 65536 / 360000000));
+    }
+    int32_t dlat = latitude - t->latitude;
+    int32_t dlon = longitude - t->longitude;
+    if (dlon > 180000000) dlon -= 360000000;  // Across the antimeridian
+    if (dlon < -180000000) dlon += 360000000;
+    int64_t north = (int64_t)dlat * MM_PER_UDEG_NUM / MM_PER_UDEG_DEN;
+    int64_t east = (int64_t)dlon * t->cos_latitude * MM_PER_UDEG_NUM / ((int64_t)MM_PER_UDEG_DEN << 15);
+    return hypot64(north, east);
+}
+
+void trip_update(trip_t* t, const gps_data* g) {
+    uint8_t needed = GPS_HAS_POSITION | GPS_HAS_TIME;
+    if ((g->valid & needed) != needed || !(g->fresh & GPS_HAS_POSITION)) return;
+
+    bool moving = (g->valid & GPS_HAS_SPEED) && g->speed >= TRIP_MOVING_SPEED;
+    if (moving && g->speed > t->max_speed) t->max_speed = g->speed;
+    if (t->have_fix) {
+        uint32_t dt = (g->time + 86400 - t->time) % 86400;  // Across midnight too
+        if (moving && dt <= TRIP_MAX_GAP) {
+            uint64_t step = step_mm(t, g->latitude, g->longitude);
+            t->distance_mm += step;
+            t->odometer_mm += step;
+            t->moving_s += dt;
+        }
+    }
+    t->have_fix = true;
+    t->latitude = g->latitude;
+    t->longitude = g->longitude;
+    t->time = g->time;
+}
+
+bool trip_save_due(const trip_t* t) {
+    return trip_odometer_m(t) >= t->saved_m + ODOMETER_SAVE_METERS;
+}
+
+void trip_save(trip_t* t) {
+    if (trip_save_due(t)) odometer_save(t, trip_odometer_m(t));
+}
+
+uint32_t trip_distance_m(const trip_t* t) {
+    return (uint32_t)(t->distance_mm / 1000);
+}
+
+uint32_t trip_avg_speed(const trip_t* t) {
+    if (t->moving_s == 0) return 0;
+    return (uint32_t)(t->distance_mm * 36 / ((uint64_t)t->moving_s * 100));
+}
+
+uint32_t trip_odometer_m(const trip_t* t) {
+    return (uint32_t)(t->odometer_mm / 1000);
+}
@@ -0,0 +1,129 @@
+// Render the static page chrome and write it run-length encoded as C
+//
+//   cc -Isim/include -Iinclude -Isrc tools/gen_backgrounds.c src/font.c src/font_tables.c src/trig.c \
+//      src/sine_table.c src/history.c -lm -o gen_backgrounds
+//   ./gen_backgrounds src/backgrounds.c
+//
+// Runs the display_*_chrome functions from src/lcd.h into the framebuffer on
+// the host (against the stand-in SDK headers in sim/include), so the images
+// are exactly what the firmware used to draw on page entry. The encoding is
+// described in include/background.h. tools/gen_backgrounds.py runs this as a
+// PlatformIO pre-build step when lcd.h, font.c or this file change.
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "font.h"
+#include "gpsdata.h"
+#include "trig.h"
+#include "history.h"
+#include "background.h"
+#include "lcd.h"
+
+// Everything is drawn into the framebuffer, so the SPI side is never used
+spi_stats_t spi_stats;
+spi_inst_t* const spi0 = NULL;
+void send_spi_cmd(spi_inst_t* spi, uint8_t cmd) { (void)spi; (void)cmd; }
+void send_spi_data16(spi_inst_t* spi, uint16_t data, bool is_long) { (void)spi; (void)data; (void)is_long; }
+void spi_burst_fill(uint16_t color, uint32_t count, spi_burst_cb_t done) { (void)color; (void)count; (void)done; }
+void spi_burst_write(const uint16_t* pixels, uint32_t count, spi_burst_cb_t done) { (void)pixels; (void)count; (void)done; }
+void spi_burst_wait() {}
+
+// lcd.h refers to the images this program produces
+const bg_image_t bg_speed, bg_location, bg_time, bg_sky, bg_trip, bg_all;
+
+static void chrome_speed() { display_speed_chrome(10, 10, 0); }
+static void chrome_location() { display_location_chrome(10, 10, 0); }
+static void chrome_time() { display_time_chrome(10, 10, 0); }
+static void chrome_sky() { display_sky_chrome(10, 10); }
+static void chrome_trip() { display_trip_chrome(10, 10); }
+
+static const struct {
+    const char* name;
+    void (*draw)(void);
+} pages[] = {
+    { "bg_speed", chrome_speed },
+    { "bg_location", chrome_location },
+    { "bg_time", chrome_time },
+    { "bg_sky", chrome_sky },
+    { "bg_trip", chrome_trip },
+    { "bg_all", display_all_chrome },
+};
+
+static uint16_t words[TFT_WIDTH * TFT_HEIGHT * 2];
+static uint16_t rows[TFT_HEIGHT];
+
+// Length of the run of equal pixels starting at row[i]
+static int run_length(const uint16_t* row, int i) {
+    int n = 1;
+    while (i + n < TFT_WIDTH && row[i + n] == row[i]) n++;
+    return n;
+}
+
+// Encode one row at words[count]; returns the new count
+// Runs of 3 or more pixels are stored as runs, anything shorter joins a literal
+static uint32_t encode_row(const uint16_t* row, uint32_t count) {
+    int i = 0;
+    while (i < TFT_WIDTH) {
+        int n = run_length(row, i);
+        if (n >= 3) {
+            words[count++] = n;
+            words[count++] = row[i];
+            i += n;
+            continue;
+        }
+        int start = i;
+        while (i < TFT_WIDTH && run_length(row, i) < 3) i++;
+        words[count++] = BG_LITERAL | (i - start);
+        for (int k = start; k < i; k++) words[count++] = row[k];
+    }
+    return count;
+}
+
+static void write_array(FILE* out, const char* name, const uint16_t* data, uint32_t count) {
+    fprintf(out, "static const uint16_t %s[%lu] = {", name, (unsigned long)count);
+    for (uint32_t i = 0; i < count; i++) {
+        fprintf(out, "%s 0x%04X,", i % 12 ? "" : "\n   ", data[i]);
+    }
+    fprintf(out, "\n};\n\n");
+}
+
+int main(int argc, char** argv) {
+    FILE* out = argc > 1 ? fopen(argv[1], "w") : stdout;
+    if (!out) {
+        perror(argv[1]);
+        return 1;
+    }
+    fprintf(out, "// Generated by tools/gen_backgrounds.c from the display_*_chrome functions\n");
+    fprintf(out, "// in src/lcd.h. Do not edit; rebuild to regenerate.\n");
+    fprintf(out, "#include \"background.h\"\n\n");
+
+    tft_target = TFT_TARGET_FRAMEBUFFER;
+    for (size_t p = 0; p < sizeof(pages) / sizeof(pages[0]); p++) {
+        tft_fill_screen(RGB565(255, 255, 255));
+        pages[p].draw();
+
+        uint32_t count = 0;
+        for (int y = 0; y < TFT_HEIGHT; y++) {
+            rows[y] = count;
+            count = encode_row(&framebuffer[y * TFT_WIDTH], count);
+        }
+        if (count > 0xFFFF) {
+            fprintf(stderr, "%s: %lu words, too many for 16-bit row offsets\n", pages[p].name, (unsigned long)count);
+            return 1;
+        }
+
+        char name[64];
+        fprintf(out, "// %s: %lu words for %d pixels\n", pages[p].name, (unsigned long)count, TFT_WIDTH * TFT_HEIGHT);
+        snprintf(name, sizeof(name), "%s_data", pages[p].name);
+        write_array(out, name, words, count);
+        snprintf(name, sizeof(name), "%s_rows", pages[p].name);
+        write_array(out, name, rows, TFT_HEIGHT);
+        fprintf(out, "const bg_image_t %s = { %d, %d, %s_rows, %s_data };\n\n", pages[p].name,
+                TFT_WIDTH, TFT_HEIGHT, pages[p].name, pages[p].name);
+    }
+    if (out != stdout) fclose(out);
+    return 0;
+}
@@ -0,0 +1,56 @@
+# Regenerate src/backgrounds.c when the page chrome changes
+#
+# PlatformIO pre-build script (extra_scripts in platformio.ini); can also be
+# run by hand from the project directory:
+#   python tools/gen_backgrounds.py
+#
+# Builds tools/gen_backgrounds.c with the host C compiler (HOSTCC, default cc)
+# and runs it. src/backgrounds.c is checked in, so a machine without a host
+# compiler still builds with the last generated images; with a compiler, a
+# generator that fails to build or run stops the build.
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+try:
+    Import("env")  # noqa: F821 (defined by PlatformIO)
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+OUTPUT = os.path.join(ROOT, "src", "backgrounds.c")
+INPUTS = ["src/lcd.h", "src/font.c", "src/font_tables.c", "include/font.h", "include/background.h", "tools/gen_backgrounds.c"]
+
+
+def stale():
+    if not os.path.exists(OUTPUT):
+        return True
+    built = os.path.getmtime(OUTPUT)
+    return any(os.path.getmtime(os.path.join(ROOT, f)) > built for f in INPUTS)
+
+
+def generate():
+    cc = os.environ.get("HOSTCC", "cc")
+    if not shutil.which(cc):
+        print("gen_backgrounds: no host compiler (%s), keeping the existing src/backgrounds.c" % cc,
+              file=sys.stderr)
+        return
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = os.path.join(tmp, "gen_backgrounds")
+        build = [cc, "-O1", "-Isim/include", "-Iinclude", "-Isrc",
+                 "tools/gen_backgrounds.c", "src/font.c", "src/font_tables.c", "src/trig.c",
+                 "src/sine_table.c", "src/history.c", "-lm", "-o", exe]
+        try:
+            subprocess.run(build, cwd=ROOT, check=True)
+            subprocess.run([exe, OUTPUT], cwd=ROOT, check=True)
+        except (OSError, subprocess.CalledProcessError) as e:
+            print("gen_backgrounds: failed, src/backgrounds.c is out of date (%s)" % e, file=sys.stderr)
+            sys.exit(1)
+    print("gen_backgrounds: wrote src/backgrounds.c")
+
+
+if stale():
+    generate()
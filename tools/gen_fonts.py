@@ -0,0 +1,117 @@
+# Build the bitmap font tables (src/font_tables.c)
+#
+# PlatformIO pre-build script (extra_scripts in platformio.ini); can also be
+# run by hand from the project directory:
+#   python tools/gen_fonts.py
+#
+# Writes the row expansion tables used to scale glyph rows in one lookup, and
+# a font_t for every source bitmap in tools/fonts/*.txt (format described at
+# the top of each file). The 8x8 font stays hand-written in src/font.c. The
+# output is only rewritten when it is older than its sources.
+
+import glob
+import os
+
+try:
+    Import("env")  # noqa: F821 (defined by PlatformIO)
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCES = sorted(glob.glob(os.path.join(ROOT, "tools", "fonts", "*.txt")))
+OUTPUT = os.path.join(ROOT, "src", "font_tables.c")
+
+
+def stale():
+    if not os.path.exists(OUTPUT):
+        return True
+    built = os.path.getmtime(OUTPUT)
+    return any(os.path.getmtime(f) > built for f in SOURCES + [os.path.abspath(__file__)])
+
+
+def expand(byte, scale):
+    bits = 0
+    for i in range(8):
+        bit = (byte >> (7 - i)) & 1
+        for _ in range(scale):
+            bits = (bits << 1) | bit
+    return bits
+
+
+def parse(path):
+    font = None
+    glyphs = {}
+    current = None
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith(";"):
+                continue
+            words = line.split()
+            if words[0] == "font":
+                name, width, height, scale, spacing = words[1], *map(int, words[2:6])
+                font = dict(name=name, width=width, height=height, scale=scale, spacing=spacing)
+            elif words[0] == "glyph":
+                current = glyphs.setdefault(line[len("glyph "):][:1] or " ", [])
+            else:
+                if current is None or len(line) != font["width"]:
+                    raise SystemExit("%s:%d: bad glyph row" % (path, number))
+                current.append(line)
+
+    chars = sorted(glyphs)
+    first, last = ord(chars[0]), ord(chars[-1])
+    if len(chars) != last - first + 1:
+        raise SystemExit("%s: glyphs must be a contiguous character range" % path)
+    bytes_per_row = (font["width"] + 7) // 8
+    if bytes_per_row * 8 * font["scale"] > 32 or font["scale"] not in (1, 2, 3):
+        raise SystemExit("%s: scaled rows must fit in 32 bits with scale 1..3" % path)
+
+    data = []
+    for c in chars:
+        rows = glyphs[c]
+        if len(rows) != font["height"]:
+            raise SystemExit("%s: glyph %r has %d rows" % (path, c, len(rows)))
+        for row in rows:
+            bits = int(row.replace("#", "1").replace(".", "0"), 2) << (bytes_per_row * 8 - font["width"])
+            data.extend((bits >> (8 * (bytes_per_row - 1 - i))) & 0xFF for i in range(bytes_per_row))
+    font.update(first=first, count=len(chars), bytes_per_row=bytes_per_row, data=data, chars="".join(chars))
+    return font
+
+
+def table(lines, decl, values, per_line, fmt):
+    lines.append(decl + " = {")
+    for i in range(0, len(values), per_line):
+        lines.append("    " + " ".join(fmt % v + "," for v in values[i:i + per_line]))
+    lines.append("};")
+    lines.append("")
+
+
+def generate():
+    lines = [
+        "// Generated by tools/gen_fonts.py from tools/fonts/*.txt. Do not edit;",
+        "// rebuild to regenerate.",
+        '#include "font.h"',
+        "",
+        "// Each source bit repeated 2 and 3 times, MSB first",
+    ]
+    table(lines, "const uint16_t font_expand2[256]", [expand(b, 2) for b in range(256)], 8, "0x%04X")
+    table(lines, "const uint32_t font_expand3[256]", [expand(b, 3) for b in range(256)], 6, "0x%06X")
+
+    for path in SOURCES:
+        font = parse(path)
+        name = font["name"]
+        lines.append("// %s: %r from %s" % (name, font["chars"], os.path.relpath(path, ROOT)))
+        table(lines, "static const uint8_t %s_bitmap[%d]" % (name, len(font["data"])), font["data"], 12, "0x%02X")
+        scale = font["scale"]
+        lines.append("const font_t %s = { %s_bitmap, %d, %d, %d, %d, %d, %d, %d, %d };" % (
+            name, name, font["first"], font["count"], font["height"], font["bytes_per_row"], scale,
+            font["width"] * scale, font["height"] * scale, font["width"] * scale + font["spacing"]))
+        lines.append("")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(lines))
+    print("gen_fonts: wrote src/font_tables.c")
+
+
+if stale():
+    generate()
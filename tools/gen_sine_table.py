@@ -0,0 +1,53 @@
+# Write the Q15 quarter-wave sine table (src/sine_table.c)
+#
+# PlatformIO pre-build script (extra_scripts in platformio.ini); can also be
+# run by hand from the project directory:
+#   python tools/gen_sine_table.py
+#
+# The table size comes from SINE_TABLE_BITS in include/trig.h. The file is only
+# rewritten when it is missing or older than trig.h or this script.
+
+import math
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 (defined by PlatformIO)
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+HEADER = os.path.join(ROOT, "include", "trig.h")
+OUTPUT = os.path.join(ROOT, "src", "sine_table.c")
+
+
+def stale():
+    if not os.path.exists(OUTPUT):
+        return True
+    built = os.path.getmtime(OUTPUT)
+    return any(os.path.getmtime(f) > built for f in (HEADER, os.path.abspath(__file__)))
+
+
+def generate():
+    with open(HEADER) as f:
+        bits = int(re.search(r"#define SINE_TABLE_BITS (\d+)", f.read()).group(1))
+    steps = 1 << bits
+    values = [min(32767, round(math.sin(math.pi / 2 * i / steps) * 32768)) for i in range(steps + 1)]
+
+    lines = [
+        "// Generated by tools/gen_sine_table.py. Do not edit; rebuild to regenerate.",
+        '#include "trig.h"',
+        "",
+        "// sin(90 degrees * i / %d) in Q15" % steps,
+        "const int16_t sine_table[%d] = {" % (steps + 1),
+    ]
+    for i in range(0, len(values), 12):
+        lines.append("    " + " ".join("%d," % v for v in values[i:i + 12]))
+    lines.append("};")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("gen_sine_table: wrote src/sine_table.c")
+
+
+if stale():
+    generate()
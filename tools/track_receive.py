@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# Download the track log over the device's USB serial port
+#
+#   track_receive.py /dev/ttyACM0 track.csv
+#
+# Sends "EXPORT <index>" and writes one CSV row per record. If the CSV already
+# exists the download resumes after its last index, so an interrupted transfer
+# can simply be run again. Frame layout matches track_frame_t in src/main.c and
+# records match track_record_t in include/track.h.
+# Needs pyserial (pip install pyserial).
+
+import csv
+import datetime
+import os
+import struct
+import sys
+
+import serial
+
+FRAME = struct.Struct("<3scIHH")    # magic, type, index, count, reserved
+RECORD = struct.Struct("<IiiHBB")   # time, latitude, longitude, speed, course, check
+EPOCH = datetime.datetime(2000, 1, 1, tzinfo=datetime.timezone.utc)
+
+
+def record_ok(raw):
+    check = 0
+    for b in raw[:-1]:
+        check ^= b
+    return raw[:4] != b"\xff\xff\xff\xff" and check == raw[-1]
+
+
+def last_index(path):
+    if not os.path.exists(path):
+        return None
+    last = None
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            last = int(row["index"])
+    return last
+
+
+def read_exact(port, n):
+    data = bytearray()
+    while len(data) < n:
+        chunk = port.read(n - len(data))
+        if not chunk:
+            raise TimeoutError("device stopped sending")
+        data += chunk
+    return bytes(data)
+
+
+def sync_frame(port):
+    # Skip console text until a frame header starts
+    window = b""
+    while window != b"TRK":
+        window = (window + read_exact(port, 1))[-3:]
+    return FRAME.unpack(b"TRK" + read_exact(port, FRAME.size - 3))
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: track_receive.py <serial port> <output.csv>")
+    device, path = sys.argv[1], sys.argv[2]
+
+    last = last_index(path)
+    start = 0 if last is None else last + 1
+    new_file = last is None
+
+    with serial.Serial(device, timeout=2) as port, open(path, "a", newline="") as out:
+        writer = csv.writer(out)
+        if new_file:
+            writer.writerow(["index", "utc", "latitude", "longitude", "speed_kmh", "course_deg"])
+        port.reset_input_buffer()
+        port.write(b"EXPORT %d\n" % start)
+
+        records = 0
+        total = 0
+        while True:
+            _, kind, index, count, _ = sync_frame(port)
+            if kind == b"E":
+                break
+            payload = read_exact(port, count * RECORD.size)
+            total += len(payload) + FRAME.size
+            for i in range(count):
+                raw = payload[i * RECORD.size:(i + 1) * RECORD.size]
+                if not record_ok(raw):
+                    continue  # Unused slot or torn page
+                t, lat, lon, speed, course, _ = RECORD.unpack(raw)
+                utc = EPOCH + datetime.timedelta(seconds=t)
+                writer.writerow([index + i, utc.isoformat(), lat / 1e6, lon / 1e6,
+                                 speed / 100, round(course * 360 / 256, 1)])
+                records += 1
+
+    print(f"{records} records ({total} bytes) from index {start}, next export starts at {index}")
+
+
+if __name__ == "__main__":
+    main()